@@ -0,0 +1,413 @@
+#ifndef _GLIBMM_BENCHMARKS_BENCHMARK_H
+#define _GLIBMM_BENCHMARKS_BENCHMARK_H
+
+/* Copyright (C) 2026 The glibmm Development Team
+ *
+ * This file is part of glibmm.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// A minimal microbenchmark harness, shared by all benchmark programs.
+//
+// Each program creates a Bench::Runner, adds its benchmarks and calls run().
+// A benchmark is a function that runs its timed operation
+// State::iterations() times. The runner calibrates the number of iterations
+// so that one measurement takes at least --min-time seconds, then repeats
+// the measurement --repetitions times and reports the median, minimum, mean
+// and standard deviation of the time per iteration.
+//
+// Options:
+//   --json FILE        Also write the results to FILE, for compare.py.
+//   --filter TEXT      Only run benchmarks whose names contain TEXT.
+//   --min-time SEC     Minimum duration of one measurement (default 0.1).
+//   --repetitions N    Number of measurements (default 5).
+//   --list             Print the names of the benchmarks and exit.
+
+#include <glibmm.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib> // EXIT_SUCCESS, EXIT_FAILURE
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace Bench
+{
+
+/** Prevents the compiler from optimizing away the computation of @a value.
+ */
+template <class T>
+inline void
+do_not_optimize(const T& value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+  asm volatile("" : : "r,m"(value) : "memory");
+#else
+  static_cast<void>(*static_cast<const volatile char*>(static_cast<const void*>(&value)));
+#endif
+}
+
+/** Makes the compiler assume that all memory may have been read and written.
+ */
+inline void
+clobber_memory()
+{
+#if defined(__GNUC__) || defined(__clang__)
+  asm volatile("" : : : "memory");
+#endif
+}
+
+class State
+{
+public:
+  explicit State(std::size_t iterations) : iterations_(iterations) {}
+
+  /// The number of times that the timed operation shall be run.
+  std::size_t iterations() const { return iterations_; }
+
+  /// Restarts the timer, excluding the setup before the timed loop.
+  void reset_timer() { stop_watch_.start(); }
+
+  /// Stops the timer, excluding the clean-up after the timed loop.
+  void stop_timer()
+  {
+    if (elapsed_ns_ < 0)
+      elapsed_ns_ = stop_watch_.elapsed_ns();
+  }
+
+  /// The number of items processed per iteration, for the items/s column.
+  void set_items_per_iteration(double items) { items_per_iteration_ = items; }
+
+  /// The number of bytes processed per iteration, for the bytes/s column.
+  void set_bytes_per_iteration(double bytes) { bytes_per_iteration_ = bytes; }
+
+  /// Marks the benchmark as skipped. The benchmark function shall return.
+  void skip(const std::string& reason) { skip_reason_ = reason; }
+
+private:
+  friend class Runner;
+
+  std::size_t iterations_;
+  Glib::StopWatch stop_watch_;
+  gint64 elapsed_ns_ = -1;
+  double items_per_iteration_ = 0.0;
+  double bytes_per_iteration_ = 0.0;
+  std::string skip_reason_;
+};
+
+class Runner
+{
+public:
+  using Function = std::function<void(State&)>;
+
+  Runner(const std::string& suite, int argc, char** argv);
+
+  /// Adds a benchmark. Its name is prefixed with the name of the suite.
+  void add(const std::string& name, Function function);
+
+  /// Runs all benchmarks and returns the exit status of the program.
+  int run();
+
+private:
+  struct Result
+  {
+    std::string name;
+    std::string skip_reason;
+    std::size_t iterations = 0;
+    double median_ns = 0.0;
+    double min_ns = 0.0;
+    double mean_ns = 0.0;
+    double stddev_ns = 0.0;
+    double items_per_second = 0.0;
+    double bytes_per_second = 0.0;
+  };
+
+  static double run_once(const Function& function, std::size_t iterations, State& state);
+  Result measure(const std::string& name, const Function& function) const;
+  static void print(const Result& result);
+  void write_json(const std::vector<Result>& results) const;
+  static std::string json_string(const std::string& text);
+
+  std::string suite_;
+  std::vector<std::pair<std::string, Function>> benchmarks_;
+  std::string json_file_;
+  std::string filter_;
+  double min_time_ = 0.1;
+  int repetitions_ = 5;
+  bool list_ = false;
+  bool bad_arguments_ = false;
+};
+
+inline Runner::Runner(const std::string& suite, int argc, char** argv)
+: suite_(suite)
+{
+  Glib::init();
+
+  for (int i = 1; i < argc; ++i)
+  {
+    const std::string arg = argv[i];
+    const bool has_value = i + 1 < argc;
+    if (arg == "--json" && has_value)
+      json_file_ = argv[++i];
+    else if (arg == "--filter" && has_value)
+      filter_ = argv[++i];
+    else if (arg == "--min-time" && has_value)
+      min_time_ = std::strtod(argv[++i], nullptr);
+    else if (arg == "--repetitions" && has_value)
+      repetitions_ = std::atoi(argv[++i]);
+    else if (arg == "--list")
+      list_ = true;
+    else
+      bad_arguments_ = true;
+  }
+
+  if (min_time_ <= 0.0 || repetitions_ < 1)
+    bad_arguments_ = true;
+}
+
+inline void
+Runner::add(const std::string& name, Function function)
+{
+  benchmarks_.emplace_back(suite_ + '/' + name, std::move(function));
+}
+
+inline int
+Runner::run()
+{
+  if (bad_arguments_)
+  {
+    std::cerr << "Usage: " << g_get_prgname()
+              << " [--json FILE] [--filter TEXT] [--min-time SEC] [--repetitions N] [--list]"
+              << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  std::vector<Result> results;
+  bool failed = false;
+  for (const auto& [name, function] : benchmarks_)
+  {
+    if (name.find(filter_) == std::string::npos)
+      continue;
+    if (list_)
+    {
+      std::cout << name << std::endl;
+      continue;
+    }
+
+    try
+    {
+      results.push_back(measure(name, function));
+      print(results.back());
+    }
+    catch (const Glib::Error& error)
+    {
+      std::cerr << name << " failed: " << error.what() << std::endl;
+      failed = true;
+    }
+    catch (const std::exception& error)
+    {
+      std::cerr << name << " failed: " << error.what() << std::endl;
+      failed = true;
+    }
+  }
+
+  if (!list_ && !json_file_.empty())
+    write_json(results);
+  return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+inline double
+Runner::run_once(const Function& function, std::size_t iterations, State& state)
+{
+  state = State(iterations);
+  function(state);
+  state.stop_timer();
+  return static_cast<double>(state.elapsed_ns_);
+}
+
+inline Runner::Result
+Runner::measure(const std::string& name, const Function& function) const
+{
+  Result result;
+  result.name = name;
+
+  // Calibrate. This also warms up caches and lazily initialized state.
+  const double min_time_ns = min_time_ * 1.0e9;
+  State state(1);
+  std::size_t iterations = 1;
+  for (;;)
+  {
+    const double elapsed_ns = run_once(function, iterations, state);
+    if (!state.skip_reason_.empty())
+    {
+      result.skip_reason = state.skip_reason_;
+      return result;
+    }
+    if (elapsed_ns >= min_time_ns)
+      break;
+
+    // Aim for 20% more than the minimum time, but grow by at most 10 times.
+    const double ns_per_iteration = std::max(elapsed_ns, 1.0) / iterations;
+    const double predicted = min_time_ns * 1.2 / ns_per_iteration;
+    iterations = static_cast<std::size_t>(
+      std::clamp(predicted, iterations + 1.0, iterations * 10.0));
+  }
+
+  std::vector<double> ns_per_iteration;
+  for (int i = 0; i < repetitions_; ++i)
+    ns_per_iteration.push_back(run_once(function, iterations, state) / iterations);
+
+  std::vector<double> sorted = ns_per_iteration;
+  std::sort(sorted.begin(), sorted.end());
+  const std::size_t n = sorted.size();
+  result.iterations = iterations;
+  result.median_ns = n % 2 ? sorted[n / 2] : (sorted[n / 2 - 1] + sorted[n / 2]) / 2;
+  result.min_ns = sorted.front();
+  for (const double value : sorted)
+    result.mean_ns += value / n;
+  if (n > 1)
+  {
+    double sum_of_squares = 0.0;
+    for (const double value : sorted)
+      sum_of_squares += (value - result.mean_ns) * (value - result.mean_ns);
+    result.stddev_ns = std::sqrt(sum_of_squares / (n - 1));
+  }
+
+  if (result.median_ns > 0.0)
+  {
+    result.items_per_second = state.items_per_iteration_ * 1.0e9 / result.median_ns;
+    result.bytes_per_second = state.bytes_per_iteration_ * 1.0e9 / result.median_ns;
+  }
+  return result;
+}
+
+inline void
+Runner::print(const Result& result)
+{
+  if (!result.skip_reason.empty())
+  {
+    std::printf("%-50s skipped: %s\n", result.name.c_str(), result.skip_reason.c_str());
+    std::fflush(stdout);
+    return;
+  }
+
+  std::string throughput;
+  char buffer[64];
+  if (result.bytes_per_second > 0.0)
+  {
+    std::snprintf(buffer, sizeof(buffer), "%10.1f MB/s", result.bytes_per_second * 1.0e-6);
+    throughput = buffer;
+  }
+  else if (result.items_per_second > 0.0)
+  {
+    std::snprintf(buffer, sizeof(buffer), "%10.2f M/s", result.items_per_second * 1.0e-6);
+    throughput = buffer;
+  }
+
+  const double relative_stddev =
+    result.mean_ns > 0.0 ? 100.0 * result.stddev_ns / result.mean_ns : 0.0;
+  std::printf("%-50s %12.1f ns/iter  +-%5.1f%%  %s\n", result.name.c_str(), result.median_ns,
+    relative_stddev, throughput.c_str());
+  std::fflush(stdout);
+}
+
+inline std::string
+Runner::json_string(const std::string& text)
+{
+  std::string quoted = "\"";
+  for (const char c : text)
+  {
+    if (c == '"' || c == '\\')
+    {
+      quoted += '\\';
+      quoted += c;
+    }
+    else if (static_cast<unsigned char>(c) < 0x20)
+    {
+      char buffer[8];
+      std::snprintf(buffer, sizeof(buffer), "\\u%04x", c);
+      quoted += buffer;
+    }
+    else
+      quoted += c;
+  }
+  return quoted + '"';
+}
+
+inline void
+Runner::write_json(const std::vector<Result>& results) const
+{
+  std::ostringstream out;
+  out.precision(6);
+  out << "{\n"
+      << "  \"suite\": " << json_string(suite_) << ",\n"
+      << "  \"context\": {\n"
+      << "    \"date\": "
+      << json_string(Glib::DateTime::create_now_utc().format_iso8601()) << ",\n"
+      << "    \"host_name\": " << json_string(g_get_host_name()) << ",\n"
+      << "    \"num_cpus\": " << g_get_num_processors() << ",\n"
+      << "    \"glibmm_version\": \"" << GLIBMM_MAJOR_VERSION << '.' << GLIBMM_MINOR_VERSION
+      << '.' << GLIBMM_MICRO_VERSION << "\",\n"
+      << "    \"glib_version\": \"" << glib_major_version << '.' << glib_minor_version << '.'
+      << glib_micro_version << "\",\n"
+#ifdef __VERSION__
+      << "    \"compiler\": " << json_string(__VERSION__) << ",\n"
+#endif
+#ifdef NDEBUG
+      << "    \"ndebug\": true,\n"
+#else
+      << "    \"ndebug\": false,\n"
+#endif
+      << "    \"min_time\": " << min_time_ << ",\n"
+      << "    \"repetitions\": " << repetitions_ << "\n"
+      << "  },\n"
+      << "  \"benchmarks\": [";
+
+  bool first = true;
+  for (const Result& result : results)
+  {
+    out << (first ? "\n" : ",\n") << "    {\"name\": " << json_string(result.name);
+    first = false;
+    if (!result.skip_reason.empty())
+    {
+      out << ", \"skipped\": " << json_string(result.skip_reason) << '}';
+      continue;
+    }
+    out << ", \"iterations\": " << result.iterations << ", \"median_ns\": " << result.median_ns
+        << ", \"min_ns\": " << result.min_ns << ", \"mean_ns\": " << result.mean_ns
+        << ", \"stddev_ns\": " << result.stddev_ns;
+    if (result.items_per_second > 0.0)
+      out << ", \"items_per_second\": " << result.items_per_second;
+    if (result.bytes_per_second > 0.0)
+      out << ", \"bytes_per_second\": " << result.bytes_per_second;
+    out << '}';
+  }
+  out << "\n  ]\n}\n";
+
+  std::ofstream file(json_file_);
+  file << out.str();
+  if (!file)
+    std::cerr << "Can't write " << json_file_ << std::endl;
+}
+
+} // namespace Bench
+
+#endif /* _GLIBMM_BENCHMARKS_BENCHMARK_H */
@@ -0,0 +1,103 @@
+#!/usr/bin/env python3
+
+# Compares two sets of benchmark results, written by the benchmark programs
+# with --json FILE.
+
+# compare.py [options] <baseline> <contender>
+#
+# <baseline> and <contender> are JSON files, or directories that contain JSON
+# files, such as <builddir>/benchmarks after 'meson test --benchmark'.
+# Benchmarks are matched by name. The time of each benchmark in <contender>
+# is compared with its time in <baseline>.
+
+import argparse
+import json
+import os
+import sys
+
+def load_results(path):
+  if os.path.isdir(path):
+    filenames = sorted(os.path.join(path, name) for name in os.listdir(path)
+                       if name.endswith('.json'))
+  else:
+    filenames = [path]
+
+  results = {}
+  for filename in filenames:
+    with open(filename, encoding='utf-8') as file:
+      data = json.load(file)
+    for benchmark in data.get('benchmarks', []):
+      results[benchmark['name']] = benchmark
+  return results
+
+def format_time(ns):
+  for unit, factor in (('s', 1e9), ('ms', 1e6), ('us', 1e3)):
+    if ns >= factor:
+      return '{:.2f} {}'.format(ns / factor, unit)
+  return '{:.2f} ns'.format(ns)
+
+def main():
+  parser = argparse.ArgumentParser(description='Compare two sets of glibmm benchmark results.')
+  parser.add_argument('baseline', help='JSON file or directory with JSON files')
+  parser.add_argument('contender', help='JSON file or directory with JSON files')
+  parser.add_argument('--metric', choices=['median', 'min', 'mean'], default='median',
+                      help='time to compare (default: median)')
+  parser.add_argument('--threshold', type=float, default=5.0,
+                      help='changes smaller than this percentage are not reported '
+                           'as improvements or regressions (default: 5)')
+  parser.add_argument('--filter', default='',
+                      help='compare only benchmarks whose names contain this text')
+  parser.add_argument('--fail-on-regression', action='store_true',
+                      help='exit with status 1 if any benchmark has regressed')
+  args = parser.parse_args()
+
+  baseline = load_results(args.baseline)
+  contender = load_results(args.contender)
+  key = args.metric + '_ns'
+
+  names = [name for name in baseline if name in contender and args.filter in name]
+  if not names:
+    print('No common benchmarks.', file=sys.stderr)
+    return 2
+
+  only_one = sorted(name for name in set(baseline) ^ set(contender) if args.filter in name)
+  width = max(len(name) for name in ['Benchmark'] + names + only_one)
+  print('{:<{}}  {:>12}  {:>12}  {:>9}'.format('Benchmark', width, 'Baseline', 'Contender', 'Change'))
+
+  n_compared = 0
+  n_regressions = 0
+  n_improvements = 0
+  for name in sorted(names):
+    old = baseline[name]
+    new = contender[name]
+    if 'skipped' in old or 'skipped' in new:
+      print('{:<{}}  skipped'.format(name, width))
+      continue
+
+    n_compared += 1
+    old_ns = old[key]
+    new_ns = new[key]
+    change = (new_ns - old_ns) / old_ns * 100.0 if old_ns > 0 else 0.0
+    verdict = ''
+    if change > args.threshold:
+      verdict = '  regression'
+      n_regressions += 1
+    elif change < -args.threshold:
+      verdict = '  improvement'
+      n_improvements += 1
+    print('{:<{}}  {:>12}  {:>12}  {:>+8.1f}%{}'.format(
+      name, width, format_time(old_ns), format_time(new_ns), change, verdict))
+
+  for name in only_one:
+    print('{:<{}}  only in {}'.format(name, width, 'baseline' if name in baseline else 'contender'))
+
+  print()
+  print('{} benchmarks compared, {} improvements, {} regressions (threshold {}%, {} time).'.format(
+    n_compared, n_improvements, n_regressions, args.threshold, args.metric))
+
+  if args.fail_on_regression and n_regressions > 0:
+    return 1
+  return 0
+
+if __name__ == '__main__':
+  sys.exit(main())
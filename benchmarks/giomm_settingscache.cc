@@ -0,0 +1,167 @@
+/* Copyright (C) 2026 The glibmm Development Team
+ *
+ * This file is part of glibmm.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Gio::Settings compared with Gio::SettingsCache.
+// Uses a temporary schema and the memory backend of GSettings.
+
+#include "benchmark.h"
+#include <giomm.h>
+#include <glib/gstdio.h>
+#include <memory>
+#include <string>
+
+namespace
+{
+
+const char schema_id[] = "org.gtkmm.benchmark.settingscache";
+
+const char schema_xml[] =
+  "<schemalist>"
+  "  <schema id='org.gtkmm.benchmark.settingscache'>"
+  "    <key name='enabled' type='b'><default>true</default></key>"
+  "    <key name='count' type='i'><default>42</default></key>"
+  "    <key name='ratio' type='d'><default>0.5</default></key>"
+  "    <key name='title' type='s'><default>'hello'</default></key>"
+  "    <key name='names' type='as'><default>['a', 'b']</default></key>"
+  "  </schema>"
+  "</schemalist>";
+
+const char skip_reason[] = "glib-compile-schemas can't be run";
+
+// Compiles the schema into @a dir. Returns false if glib-compile-schemas
+// can't be run.
+bool
+compile_schema(const std::string& dir)
+{
+  Glib::file_set_contents(Glib::build_filename(dir, std::string(schema_id) + ".gschema.xml"),
+    schema_xml);
+  try
+  {
+    int wait_status = 0;
+    Glib::spawn_sync(
+      "", { "glib-compile-schemas", dir }, Glib::SpawnFlags::SEARCH_PATH, {}, nullptr, nullptr,
+      &wait_status);
+    return g_spawn_check_wait_status(wait_status, nullptr);
+  }
+  catch (const Glib::SpawnError&)
+  {
+    return false;
+  }
+}
+
+} // anonymous namespace
+
+int
+main(int argc, char** argv)
+{
+  Bench::Runner runner("settingscache", argc, argv);
+  Gio::init();
+
+  std::string dir;
+  if (char* const tmp = g_dir_make_tmp("giomm-benchmark-settingscache-XXXXXX", nullptr))
+  {
+    dir = tmp;
+    g_free(tmp);
+  }
+
+  Glib::RefPtr<Gio::Settings> settings;
+  std::unique_ptr<Gio::SettingsCache> cache;
+  if (!dir.empty() && compile_schema(dir))
+  {
+    Glib::setenv("GSETTINGS_SCHEMA_DIR", dir);
+    Glib::setenv("GSETTINGS_BACKEND", "memory");
+    settings = Gio::Settings::create(schema_id);
+    cache = std::make_unique<Gio::SettingsCache>(settings);
+  }
+
+  runner.add("settings_get_int", [&settings](Bench::State& state) {
+    if (!settings)
+      return state.skip(skip_reason);
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+      Bench::do_not_optimize(settings->get_int("count"));
+  });
+
+  runner.add("cache_get_int_by_name", [&cache](Bench::State& state) {
+    if (!cache)
+      return state.skip(skip_reason);
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+      Bench::do_not_optimize(cache->get_int("count"));
+  });
+
+  runner.add("cache_get_int_by_key", [&cache](Bench::State& state) {
+    if (!cache)
+      return state.skip(skip_reason);
+    const auto key = cache->find_key("count");
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+      Bench::do_not_optimize(cache->get_int(key));
+  });
+
+  runner.add("settings_get_string", [&settings](Bench::State& state) {
+    if (!settings)
+      return state.skip(skip_reason);
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+      Bench::do_not_optimize(settings->get_string("title"));
+  });
+
+  runner.add("cache_get_string_by_key", [&cache](Bench::State& state) {
+    if (!cache)
+      return state.skip(skip_reason);
+    const auto key = cache->find_key("title");
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+      Bench::do_not_optimize(cache->get_string(key).size());
+  });
+
+  runner.add("settings_get_string_array", [&settings](Bench::State& state) {
+    if (!settings)
+      return state.skip(skip_reason);
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+      Bench::do_not_optimize(settings->get_string_array("names"));
+  });
+
+  runner.add("cache_get_string_array_by_key", [&cache](Bench::State& state) {
+    if (!cache)
+      return state.skip(skip_reason);
+    const auto key = cache->find_key("names");
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+      Bench::do_not_optimize(cache->get_string_array(key).size());
+  });
+
+  // A write goes through the backend, emits "changed" and refreshes the cached value.
+  runner.add("cache_set_int_refresh", [&settings, &cache](Bench::State& state) {
+    if (!cache)
+      return state.skip(skip_reason);
+    const auto key = cache->find_key("count");
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+    {
+      settings->set_int("count", static_cast<int>(i));
+      Bench::do_not_optimize(cache->get_int(key));
+    }
+  });
+
+  const int result = runner.run();
+
+  cache.reset();
+  settings.reset();
+  if (!dir.empty())
+  {
+    g_remove(Glib::build_filename(dir, std::string(schema_id) + ".gschema.xml").c_str());
+    g_remove(Glib::build_filename(dir, "gschemas.compiled").c_str());
+    g_rmdir(dir.c_str());
+  }
+  return result;
+}
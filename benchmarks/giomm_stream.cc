@@ -0,0 +1,145 @@
+/* Copyright (C) 2026 The glibmm Development Team
+ *
+ * This file is part of glibmm.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Gio stream I/O: memory streams, line reading and files.
+
+#include "benchmark.h"
+#include <giomm.h>
+#include <glib/gstdio.h>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+constexpr gsize data_size = 1024 * 1024;
+constexpr gsize chunk_size = 64 * 1024;
+
+std::string
+make_lines()
+{
+  std::string text;
+  for (int i = 0; text.size() < data_size; ++i)
+    text += "2026-01-01T00:00:00Z INFO request " + std::to_string(i) + " handled in 42 ms\n";
+  return text;
+}
+
+} // anonymous namespace
+
+int
+main(int argc, char** argv)
+{
+  Bench::Runner runner("stream", argc, argv);
+  Gio::init();
+
+  const std::string lines = make_lines();
+  const auto lines_bytes = Glib::Bytes::create(lines.data(), lines.size());
+  const std::vector<char> data(data_size, 'x');
+
+  runner.add("memory_input_read_1M", [&lines_bytes](Bench::State& state) {
+    std::vector<char> buffer(chunk_size);
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+    {
+      auto stream = Gio::MemoryInputStream::create();
+      stream->add_bytes(lines_bytes);
+      while (stream->read(buffer.data(), buffer.size()) > 0)
+        Bench::clobber_memory();
+    }
+    state.set_bytes_per_iteration(lines_bytes->get_size());
+  });
+
+  runner.add("memory_output_write_1M", [&data](Bench::State& state) {
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+    {
+      auto stream = Gio::MemoryOutputStream::create();
+      for (gsize offset = 0; offset < data.size(); offset += chunk_size)
+        stream->write(data.data() + offset, chunk_size);
+      stream->close();
+    }
+    state.set_bytes_per_iteration(data.size());
+  });
+
+  runner.add("data_input_read_line_1M", [&lines_bytes](Bench::State& state) {
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+    {
+      auto memory_stream = Gio::MemoryInputStream::create();
+      memory_stream->add_bytes(lines_bytes);
+      auto stream = Gio::DataInputStream::create(memory_stream);
+      std::string line;
+      gsize n_lines = 0;
+      while (stream->read_line(line))
+        ++n_lines;
+      Bench::do_not_optimize(n_lines);
+    }
+    state.set_bytes_per_iteration(lines_bytes->get_size());
+  });
+
+  runner.add("data_input_lines_1M", [&lines_bytes](Bench::State& state) {
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+    {
+      auto memory_stream = Gio::MemoryInputStream::create();
+      memory_stream->add_bytes(lines_bytes);
+      auto stream = Gio::DataInputStream::create(memory_stream);
+      gsize n_lines = 0;
+      for (std::string_view line : stream->lines())
+        n_lines += !line.empty();
+      Bench::do_not_optimize(n_lines);
+    }
+    state.set_bytes_per_iteration(lines_bytes->get_size());
+  });
+
+  // Files. The file is likely in the page cache, so this measures the
+  // overhead of the streams and system calls rather than of the disk.
+  std::string filename;
+  g_close(Glib::file_open_tmp(filename, "glibmm-benchmark-stream"), nullptr);
+  const auto file = Gio::File::create_for_path(filename);
+
+  runner.add("file_write_1M", [&file, &data](Bench::State& state) {
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+    {
+      auto stream = file->replace();
+      for (gsize offset = 0; offset < data.size(); offset += chunk_size)
+        stream->write(data.data() + offset, chunk_size);
+      stream->close();
+    }
+    state.set_bytes_per_iteration(data.size());
+  });
+
+  runner.add("file_read_1M", [&file, &data](Bench::State& state) {
+    {
+      auto stream = file->replace();
+      gsize bytes_written = 0;
+      stream->write_all(data.data(), data.size(), bytes_written);
+      stream->close();
+    }
+    std::vector<char> buffer(chunk_size);
+    state.reset_timer();
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+    {
+      auto stream = file->read();
+      while (stream->read(buffer.data(), buffer.size()) > 0)
+        Bench::clobber_memory();
+      stream->close();
+    }
+    state.set_bytes_per_iteration(data.size());
+  });
+
+  const int result = runner.run();
+  file->remove();
+  return result;
+}
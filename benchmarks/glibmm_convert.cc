@@ -0,0 +1,134 @@
+/* Copyright (C) 2026 The glibmm Development Team
+ *
+ * This file is part of glibmm.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Character set conversion: Glib::convert(), Glib::IConv and Glib::CharsetConverter.
+
+#include "benchmark.h"
+#include <glibmm.h>
+#include <string>
+
+namespace
+{
+
+constexpr std::size_t text_size = 64 * 1024;
+constexpr std::size_t chunk_size = 4096;
+
+// Mostly ASCII, like most source code, logs and western text.
+std::string
+make_ascii_text()
+{
+  std::string text;
+  while (text.size() < text_size)
+    text += "The quick brown fox jumps over the lazy dog. ";
+  text.resize(text_size);
+  return text;
+}
+
+// ISO-8859-1 text with a non-ASCII character in every word.
+std::string
+make_latin1_text()
+{
+  std::string text;
+  while (text.size() < text_size)
+    text += "caf\xe9 na\xefve se\xf1or \xfcber gar\xe7on ";
+  text.resize(text_size);
+  return text;
+}
+
+void
+add_converter_benchmarks(Bench::Runner& runner, const std::string& name,
+  const std::string& text, const char* to_codeset, const char* from_codeset)
+{
+  runner.add(name + "_g_convert", [&text, to_codeset, from_codeset](Bench::State& state) {
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+      Bench::do_not_optimize(Glib::convert(text, to_codeset, from_codeset));
+    state.set_bytes_per_iteration(text.size());
+  });
+
+  runner.add(name + "_iconv", [&text, to_codeset, from_codeset](Bench::State& state) {
+    Glib::IConv iconv(to_codeset, from_codeset);
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+      Bench::do_not_optimize(iconv.convert(text));
+    state.set_bytes_per_iteration(text.size());
+  });
+
+  runner.add(name + "_charset_converter", [&text, to_codeset, from_codeset](Bench::State& state) {
+    Glib::CharsetConverter converter(to_codeset, from_codeset);
+    std::string output;
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+    {
+      output.clear();
+      converter.convert(text, output);
+      converter.finish(output);
+      Bench::do_not_optimize(output);
+    }
+    state.set_bytes_per_iteration(text.size());
+  });
+
+  runner.add(name + "_charset_converter_chunked", [&text, to_codeset, from_codeset](Bench::State& state) {
+    Glib::CharsetConverter converter(to_codeset, from_codeset);
+    std::string output;
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+    {
+      output.clear();
+      for (std::size_t offset = 0; offset < text.size(); offset += chunk_size)
+        converter.convert(std::string_view(text).substr(offset, chunk_size), output);
+      converter.finish(output);
+      Bench::do_not_optimize(output);
+    }
+    state.set_bytes_per_iteration(text.size());
+  });
+}
+
+} // anonymous namespace
+
+int
+main(int argc, char** argv)
+{
+  Bench::Runner runner("convert", argc, argv);
+
+  const std::string ascii = make_ascii_text();
+  const std::string latin1 = make_latin1_text();
+  const std::string utf8 = Glib::convert(latin1, "UTF-8", "ISO-8859-1");
+
+  // ASCII fast path.
+  add_converter_benchmarks(runner, "ascii_latin1_to_utf8", ascii, "UTF-8", "ISO-8859-1");
+  add_converter_benchmarks(runner, "latin1_to_utf8", latin1, "UTF-8", "ISO-8859-1");
+  // Validation only.
+  add_converter_benchmarks(runner, "utf8_to_utf8", utf8, "UTF-8", "UTF-8");
+  // No fast path.
+  add_converter_benchmarks(runner, "ascii_utf8_to_utf16", ascii, "UTF-16LE", "UTF-8");
+
+  runner.add("charset_converter_create", [](Bench::State& state) {
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+    {
+      Glib::CharsetConverter converter("UTF-8", "ISO-8859-1");
+      Bench::do_not_optimize(converter.has_ascii_fast_path());
+    }
+  });
+
+  runner.add("iconv_create", [](Bench::State& state) {
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+    {
+      Glib::IConv iconv("UTF-8", "ISO-8859-1");
+      Bench::do_not_optimize(iconv.gobj());
+    }
+  });
+
+  return runner.run();
+}
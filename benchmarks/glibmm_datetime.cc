@@ -0,0 +1,180 @@
+/* Copyright (C) 2026 The glibmm Development Team
+ *
+ * This file is part of glibmm.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Glib::Timestamp compared with Glib::DateTime, and Glib::TimeZone conversions.
+
+#include "benchmark.h"
+#include <glibmm.h>
+#include <vector>
+
+namespace
+{
+
+constexpr std::size_t n_times = 10000;
+
+const char iso8601_text[] = "2026-03-29T01:30:15.250000+02:00";
+const char format_text[] = "%Y-%m-%d %H:%M:%S";
+const char tz_identifier[] = "Europe/Berlin";
+
+// Sorted times, one per hour from 2026-01-01T00:00:00Z.
+std::vector<gint64>
+make_times()
+{
+  std::vector<gint64> times(n_times);
+  for (std::size_t i = 0; i < n_times; ++i)
+    times[i] = 1767225600 + static_cast<gint64>(i) * 3600;
+  return times;
+}
+
+} // anonymous namespace
+
+int
+main(int argc, char** argv)
+{
+  Bench::Runner runner("datetime", argc, argv);
+
+  runner.add("datetime_parse_iso8601", [](Bench::State& state) {
+    const auto utc = Glib::TimeZone::create_utc();
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+      Bench::do_not_optimize(Glib::DateTime::create_from_iso8601(iso8601_text, utc));
+  });
+
+  runner.add("timestamp_parse_iso8601", [](Bench::State& state) {
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+      Bench::do_not_optimize(Glib::Timestamp::parse_iso8601(iso8601_text));
+  });
+
+  runner.add("datetime_format_iso8601", [](Bench::State& state) {
+    const auto date_time = Glib::DateTime::create_now_utc();
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+      Bench::do_not_optimize(date_time.format_iso8601());
+  });
+
+  runner.add("timestamp_format_iso8601", [](Bench::State& state) {
+    const auto timestamp = Glib::Timestamp::now_utc();
+    char buffer[Glib::Timestamp::iso8601_buffer_size];
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+    {
+      Bench::do_not_optimize(timestamp.format_iso8601(buffer, sizeof(buffer)));
+      Bench::clobber_memory();
+    }
+  });
+
+  runner.add("datetime_format", [](Bench::State& state) {
+    const auto date_time = Glib::DateTime::create_now_utc();
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+      Bench::do_not_optimize(date_time.format(format_text));
+  });
+
+  runner.add("timestamp_format", [](Bench::State& state) {
+    const auto timestamp = Glib::Timestamp::now_utc();
+    const Glib::TimestampFormat format(format_text);
+    char buffer[64];
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+    {
+      Bench::do_not_optimize(format.format(timestamp, buffer, sizeof(buffer)));
+      Bench::clobber_memory();
+    }
+  });
+
+  runner.add("datetime_get_fields", [](Bench::State& state) {
+    const auto date_time = Glib::DateTime::create_now_utc();
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+      Bench::do_not_optimize(date_time.get_year() + date_time.get_month() +
+                             date_time.get_day_of_month() + date_time.get_hour());
+  });
+
+  runner.add("timestamp_get_fields", [](Bench::State& state) {
+    const auto timestamp = Glib::Timestamp::now_utc();
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+      Bench::do_not_optimize(timestamp.get_year() + timestamp.get_month() +
+                             timestamp.get_day_of_month() + timestamp.get_hour());
+  });
+
+  runner.add("timezone_create_identifier", [](Bench::State& state) {
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+      Bench::do_not_optimize(Glib::TimeZone::create_identifier(tz_identifier));
+  });
+
+  runner.add("timezone_create_cached", [](Bench::State& state) {
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+      Bench::do_not_optimize(Glib::TimeZone::create_cached(tz_identifier));
+  });
+
+  const std::vector<gint64> times = make_times();
+
+  runner.add("timezone_find_interval_10000", [&times](Bench::State& state) {
+    const auto tz = Glib::TimeZone::create_cached(tz_identifier);
+    if (!tz)
+      return state.skip(std::string("time zone ") + tz_identifier + " is not installed");
+    std::vector<gint64> local_times(times.size());
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+    {
+      for (std::size_t j = 0; j < times.size(); ++j)
+        local_times[j] =
+          times[j] + tz.get_offset(tz.find_interval(Glib::TimeType::UNIVERSAL, times[j]));
+      Bench::clobber_memory();
+    }
+    state.set_items_per_iteration(times.size());
+  });
+
+  runner.add("timezone_to_local_10000", [&times](Bench::State& state) {
+    const auto tz = Glib::TimeZone::create_cached(tz_identifier);
+    if (!tz)
+      return state.skip(std::string("time zone ") + tz_identifier + " is not installed");
+    std::vector<gint64> local_times(times.size());
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+    {
+      tz.to_local(times.data(), local_times.data(), times.size());
+      Bench::clobber_memory();
+    }
+    state.set_items_per_iteration(times.size());
+  });
+
+  runner.add("timezone_adjust_time_10000", [&times](Bench::State& state) {
+    const auto tz = Glib::TimeZone::create_cached(tz_identifier);
+    if (!tz)
+      return state.skip(std::string("time zone ") + tz_identifier + " is not installed");
+    std::vector<gint64> utc_times(times.size());
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+    {
+      for (std::size_t j = 0; j < times.size(); ++j)
+      {
+        gint64 time = times[j];
+        utc_times[j] = time - tz.get_offset(tz.adjust_time(Glib::TimeType::STANDARD, time));
+      }
+      Bench::clobber_memory();
+    }
+    state.set_items_per_iteration(times.size());
+  });
+
+  runner.add("timezone_to_utc_10000", [&times](Bench::State& state) {
+    const auto tz = Glib::TimeZone::create_cached(tz_identifier);
+    if (!tz)
+      return state.skip(std::string("time zone ") + tz_identifier + " is not installed");
+    std::vector<gint64> utc_times(times.size());
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+    {
+      tz.to_utc(times.data(), utc_times.data(), times.size());
+      Bench::clobber_memory();
+    }
+    state.set_items_per_iteration(times.size());
+  });
+
+  return runner.run();
+}
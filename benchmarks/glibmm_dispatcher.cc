@@ -0,0 +1,99 @@
+/* Copyright (C) 2026 The glibmm Development Team
+ *
+ * This file is part of glibmm.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Glib::Dispatcher notifications, within a thread and between threads.
+
+#include "benchmark.h"
+#include <future>
+#include <memory>
+#include <thread>
+
+int
+main(int argc, char** argv)
+{
+  Bench::Runner runner("dispatcher", argc, argv);
+
+  runner.add("same_thread_100", [](Bench::State& state) {
+    auto context = Glib::MainContext::create();
+    Glib::Dispatcher dispatcher(context);
+    std::size_t n_received = 0;
+    dispatcher.connect([&n_received]() { ++n_received; });
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+    {
+      for (int j = 0; j < 100; ++j)
+        dispatcher.emit();
+      while (n_received < 100 * (i + 1))
+        context->iteration(true);
+    }
+    state.set_items_per_iteration(100);
+  });
+
+  // A worker thread emits as fast as it can. The time is that of one
+  // notification, when the receiver is the bottleneck.
+  runner.add("cross_thread_throughput", [](Bench::State& state) {
+    auto context = Glib::MainContext::create();
+    Glib::Dispatcher dispatcher(context);
+    std::size_t n_received = 0;
+    dispatcher.connect([&n_received]() { ++n_received; });
+    const std::size_t n = state.iterations();
+    std::thread sender([&dispatcher, n]() {
+      for (std::size_t i = 0; i < n; ++i)
+        dispatcher.emit();
+    });
+    while (n_received < n)
+      context->iteration(true);
+    sender.join();
+    state.set_items_per_iteration(1);
+  });
+
+  // The main thread notifies a worker thread, which notifies the main thread.
+  runner.add("cross_thread_round_trip", [](Bench::State& state) {
+    auto context = Glib::MainContext::create();
+    Glib::Dispatcher to_main(context);
+    std::size_t n_received = 0;
+    to_main.connect([&n_received]() { ++n_received; });
+
+    // The worker's dispatcher is created and destroyed in the worker thread.
+    auto worker_context = Glib::MainContext::create();
+    auto worker_loop = Glib::MainLoop::create(worker_context);
+    std::unique_ptr<Glib::Dispatcher> to_worker;
+    std::promise<void> worker_ready;
+    std::thread worker([&]() {
+      to_worker = std::make_unique<Glib::Dispatcher>(worker_context);
+      to_worker->connect([&to_main]() { to_main.emit(); });
+      worker_ready.set_value();
+      worker_loop->run();
+      to_worker.reset();
+    });
+    worker_ready.get_future().wait();
+    state.reset_timer();
+
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+    {
+      to_worker->emit();
+      while (n_received <= i)
+        context->iteration(true);
+    }
+
+    state.stop_timer();
+    worker_loop->quit();
+    worker.join();
+  });
+
+  return runner.run();
+}
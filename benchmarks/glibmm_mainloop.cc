@@ -0,0 +1,123 @@
+/* Copyright (C) 2026 The glibmm Development Team
+ *
+ * This file is part of glibmm.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Main loop source churn and dispatching.
+
+#include "benchmark.h"
+#include <vector>
+
+int
+main(int argc, char** argv)
+{
+  Bench::Runner runner("mainloop", argc, argv);
+
+  runner.add("iteration_empty", [](Bench::State& state) {
+    auto context = Glib::MainContext::create();
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+      context->iteration(false);
+  });
+
+  runner.add("idle_connect_disconnect", [](Bench::State& state) {
+    auto context = Glib::MainContext::create();
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+    {
+      auto connection = context->signal_idle().connect([]() { return true; });
+      connection.disconnect();
+    }
+  });
+
+  runner.add("timeout_connect_disconnect", [](Bench::State& state) {
+    auto context = Glib::MainContext::create();
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+    {
+      auto connection = context->signal_timeout().connect([]() { return true; }, 1000);
+      connection.disconnect();
+    }
+  });
+
+  runner.add("idle_connect_once_dispatch", [](Bench::State& state) {
+    auto context = Glib::MainContext::create();
+    std::size_t n_dispatched = 0;
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+    {
+      context->signal_idle().connect_once([&n_dispatched]() { ++n_dispatched; });
+      context->iteration(false);
+    }
+    Bench::do_not_optimize(n_dispatched);
+  });
+
+  runner.add("invoke_direct", [](Bench::State& state) {
+    auto context = Glib::MainContext::create();
+    std::size_t n_dispatched = 0;
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+    {
+      // No other thread owns the context, so invoke() acquires it and calls
+      // the slot directly, without a source.
+      context->invoke([&n_dispatched]() { ++n_dispatched; return false; });
+    }
+    Bench::do_not_optimize(n_dispatched);
+  });
+
+  // One iteration dispatches 100 idle sources.
+  const auto dispatch_100_idle = [](bool instrumented) {
+    return [instrumented](Bench::State& state) {
+      auto context = Glib::MainContext::create();
+      if (instrumented)
+        context->enable_instrumentation();
+      std::size_t n_dispatched = 0;
+      std::vector<sigc::connection> connections;
+      for (int j = 0; j < 100; ++j)
+        connections.push_back(
+          context->signal_idle().connect([&n_dispatched]() { ++n_dispatched; return true; }));
+      state.reset_timer();
+
+      for (std::size_t i = 0; i < state.iterations(); ++i)
+        context->iteration(false);
+
+      state.stop_timer();
+      for (auto& connection : connections)
+        connection.disconnect();
+      if (instrumented)
+        context->enable_instrumentation(false);
+      Bench::do_not_optimize(n_dispatched);
+      state.set_items_per_iteration(100);
+    };
+  };
+  runner.add("iteration_100_idle_sources", dispatch_100_idle(false));
+  runner.add("iteration_100_idle_sources_instrumented", dispatch_100_idle(true));
+
+  // A main loop that runs until 1000 idle callbacks are done.
+  runner.add("mainloop_run_1000_idle", [](Bench::State& state) {
+    auto context = Glib::MainContext::create();
+    auto loop = Glib::MainLoop::create(context);
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+    {
+      int remaining = 1000;
+      context->signal_idle().connect([&remaining, &loop]() {
+        if (--remaining > 0)
+          return true;
+        loop->quit();
+        return false;
+      });
+      loop->run();
+    }
+    state.set_items_per_iteration(1000);
+  });
+
+  return runner.run();
+}
@@ -0,0 +1,148 @@
+/* Copyright (C) 2026 The glibmm Development Team
+ *
+ * This file is part of glibmm.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Glib::Markup: Parser with AttributeMap compared with ViewParser with AttributeView.
+
+#include "benchmark.h"
+#include <glibmm.h>
+#include <string>
+
+namespace
+{
+
+constexpr int n_elements = 1000;
+
+// Something like a GtkBuilder file.
+std::string
+make_document()
+{
+  std::string text = "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n<interface>\n";
+  for (int i = 0; i < n_elements; ++i)
+  {
+    const std::string id = std::to_string(i);
+    text += "  <object class=\"GtkButton\" id=\"button" + id + "\">\n"
+            "    <property name=\"label\" translatable=\"yes\">Button &amp; " + id + "</property>\n"
+            "    <property name=\"visible\">True</property>\n"
+            "    <signal name=\"clicked\" handler=\"on_button" + id + "_clicked\" swapped=\"no\"/>\n"
+            "  </object>\n";
+  }
+  text += "</interface>\n";
+  return text;
+}
+
+class MapParser : public Glib::Markup::Parser
+{
+public:
+  std::size_t n_properties = 0;
+  std::size_t text_size = 0;
+
+protected:
+  void on_start_element(Glib::Markup::ParseContext&, const Glib::ustring& element_name,
+    const AttributeMap& attributes) override
+  {
+    if (element_name == "property")
+    {
+      const auto iter = attributes.find("name");
+      if (iter != attributes.end())
+        n_properties += iter->second.size() > 0;
+    }
+  }
+
+  void on_text(Glib::Markup::ParseContext&, const Glib::ustring& text) override
+  {
+    text_size += text.bytes();
+  }
+};
+
+class ViewParser : public Glib::Markup::ViewParser
+{
+public:
+  std::size_t n_properties = 0;
+  std::size_t text_size = 0;
+
+protected:
+  void on_start_element_view(Glib::Markup::ParseContext&, std::string_view element_name,
+    const Glib::Markup::AttributeView& attributes) override
+  {
+    if (element_name == "property")
+      n_properties += !attributes.get("name").empty();
+  }
+
+  void on_text_view(Glib::Markup::ParseContext&, std::string_view text) override
+  {
+    text_size += text.size();
+  }
+};
+
+template <class ParserType>
+void
+parse_document(Bench::State& state, const std::string& document)
+{
+  for (std::size_t i = 0; i < state.iterations(); ++i)
+  {
+    ParserType parser;
+    Glib::Markup::ParseContext context(parser);
+    context.parse(document.data(), document.data() + document.size());
+    context.end_parse();
+    Bench::do_not_optimize(parser.n_properties);
+  }
+  state.set_bytes_per_iteration(document.size());
+}
+
+} // anonymous namespace
+
+int
+main(int argc, char** argv)
+{
+  Bench::Runner runner("markup", argc, argv);
+
+  const std::string document = make_document();
+
+  runner.add("parser_attribute_map", [&document](Bench::State& state) {
+    parse_document<MapParser>(state, document);
+  });
+
+  runner.add("view_parser_attribute_view", [&document](Bench::State& state) {
+    parse_document<ViewParser>(state, document);
+  });
+
+  runner.add("view_parser_parse_stream_4k", [&document](Bench::State& state) {
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+    {
+      ViewParser parser;
+      Glib::Markup::ParseContext context(parser);
+      std::size_t offset = 0;
+      context.parse_stream([&document, &offset](char* buffer, gsize count) -> gssize {
+        const std::size_t n = document.copy(buffer, count, offset);
+        offset += n;
+        return n;
+      }, 4096);
+      Bench::do_not_optimize(parser.n_properties);
+    }
+    state.set_bytes_per_iteration(document.size());
+  });
+
+  runner.add("escape_text", [&document](Bench::State& state) {
+    const Glib::ustring text(document);
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+      Bench::do_not_optimize(Glib::Markup::escape_text(text));
+    state.set_bytes_per_iteration(text.bytes());
+  });
+
+  return runner.run();
+}
@@ -0,0 +1,137 @@
+/* Copyright (C) 2026 The glibmm Development Team
+ *
+ * This file is part of glibmm.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Glib::NodeTree: allocation with and without a Pool, and traversal.
+
+#include "benchmark.h"
+#include <glibmm.h>
+
+namespace
+{
+
+using Tree = Glib::NodeTree<int>;
+
+constexpr int n_children = 100;
+constexpr int n_grandchildren = 10;
+constexpr int n_nodes = 1 + n_children * (1 + n_grandchildren);
+
+void
+build_tree(Tree& root)
+{
+  int value = 0;
+  for (int i = 0; i < n_children; ++i)
+  {
+    Tree* const child = root.append_data(++value);
+    for (int j = 0; j < n_grandchildren; ++j)
+      child->append_data(++value);
+  }
+}
+
+void
+build_tree(Tree& root, Tree::Pool& pool)
+{
+  int value = 0;
+  for (int i = 0; i < n_children; ++i)
+  {
+    Tree& child = root.append(*pool.create(++value));
+    for (int j = 0; j < n_grandchildren; ++j)
+      child.append(*pool.create(++value));
+  }
+}
+
+} // anonymous namespace
+
+int
+main(int argc, char** argv)
+{
+  Bench::Runner runner("nodetree", argc, argv);
+
+  runner.add("build_new", [](Bench::State& state) {
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+    {
+      Tree root(0);
+      build_tree(root);
+      Bench::do_not_optimize(root.node_count());
+    }
+    state.set_items_per_iteration(n_nodes);
+  });
+
+  runner.add("build_pool", [](Bench::State& state) {
+    Tree::Pool pool;
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+    {
+      Tree root(0);
+      build_tree(root, pool);
+      Bench::do_not_optimize(root.node_count());
+    }
+    state.set_items_per_iteration(n_nodes);
+  });
+
+  runner.add("copy", [](Bench::State& state) {
+    Tree root(0);
+    build_tree(root);
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+    {
+      Tree copy(root);
+      Bench::do_not_optimize(copy.node_count());
+    }
+    state.set_items_per_iteration(n_nodes);
+  });
+
+  Tree tree(0);
+  build_tree(tree);
+
+  runner.add("traverse_slot", [&tree](Bench::State& state) {
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+    {
+      long sum = 0;
+      tree.traverse([&sum](Tree& node) { sum += node.data(); return false; },
+        Tree::TraverseType::PRE_ORDER);
+      Bench::do_not_optimize(sum);
+    }
+    state.set_items_per_iteration(n_nodes);
+  });
+
+  runner.add("nodes_iterator", [&tree](Bench::State& state) {
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+    {
+      long sum = 0;
+      for (const auto& node : tree.nodes(Tree::TraverseType::PRE_ORDER))
+        sum += node.data();
+      Bench::do_not_optimize(sum);
+    }
+    state.set_items_per_iteration(n_nodes);
+  });
+
+  runner.add("find_last", [&tree](Bench::State& state) {
+    const int last = n_nodes - 1;
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+      Bench::do_not_optimize(tree.find(last, Tree::TraverseType::PRE_ORDER));
+    state.set_items_per_iteration(n_nodes);
+  });
+
+  runner.add("find_if_last", [&tree](Bench::State& state) {
+    const int last = n_nodes - 1;
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+      Bench::do_not_optimize(tree.find_if(
+        [last](const Tree& node) { return node.data() == last; }, Tree::TraverseType::PRE_ORDER));
+    state.set_items_per_iteration(n_nodes);
+  });
+
+  return runner.run();
+}
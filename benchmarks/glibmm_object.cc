@@ -0,0 +1,384 @@
+/* Copyright (C) 2026 The glibmm Development Team
+ *
+ * This file is part of glibmm.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Object construction, Glib::wrap(), properties and Glib::Value.
+
+#include "benchmark.h"
+#include <glibmm/private/object_p.h>
+#include <vector>
+
+namespace
+{
+
+// A C type with construct properties, wrapped without gmmproc.
+typedef struct
+{
+  GObject parent;
+  int number;
+  char* label;
+} BenchProps;
+
+typedef struct
+{
+  GObjectClass parent;
+} BenchPropsClass;
+
+enum
+{
+  PROP_0,
+  PROP_NUMBER,
+  PROP_LABEL
+};
+
+G_DEFINE_TYPE(BenchProps, bench_props, G_TYPE_OBJECT)
+
+void
+bench_props_init(BenchProps*)
+{
+}
+
+void
+bench_props_finalize(GObject* gobject)
+{
+  g_free(reinterpret_cast<BenchProps*>(gobject)->label);
+  G_OBJECT_CLASS(bench_props_parent_class)->finalize(gobject);
+}
+
+void
+bench_props_set_property(GObject* gobject, guint prop_id, const GValue* value, GParamSpec*)
+{
+  auto self = reinterpret_cast<BenchProps*>(gobject);
+  if (prop_id == PROP_NUMBER)
+    self->number = g_value_get_int(value);
+  else if (prop_id == PROP_LABEL)
+  {
+    g_free(self->label);
+    self->label = g_value_dup_string(value);
+  }
+}
+
+void
+bench_props_get_property(GObject*, guint, GValue*, GParamSpec*)
+{
+}
+
+void
+bench_props_class_init(BenchPropsClass* klass)
+{
+  auto gobject_class = G_OBJECT_CLASS(klass);
+  gobject_class->finalize = &bench_props_finalize;
+  gobject_class->set_property = &bench_props_set_property;
+  gobject_class->get_property = &bench_props_get_property;
+
+  const auto flags = GParamFlags(G_PARAM_READWRITE | G_PARAM_CONSTRUCT_ONLY);
+  g_object_class_install_property(gobject_class, PROP_NUMBER,
+    g_param_spec_int("number", nullptr, nullptr, G_MININT, G_MAXINT, 0, flags));
+  g_object_class_install_property(gobject_class, PROP_LABEL,
+    g_param_spec_string("label", nullptr, nullptr, nullptr, flags));
+}
+
+class PropsObject_Class : public Glib::Class
+{
+public:
+  static void class_init_function(void* g_class, void* class_data)
+  {
+    Glib::Object_Class::class_init_function(g_class, class_data);
+  }
+
+  const Glib::Class& init()
+  {
+    if (!gtype_)
+    {
+      class_init_func_ = &PropsObject_Class::class_init_function;
+      register_derived_type(bench_props_get_type());
+    }
+    return *this;
+  }
+};
+
+class PropsObject : public Glib::Object
+{
+public:
+  PropsObject(int number, const char* label, bool)
+  : Glib::ObjectBase(nullptr),
+    Glib::Object(Glib::StackConstructParams(props_object_class_.init(),
+      "number", number, "label", label))
+  {
+  }
+
+  // Like a constructor generated by gmmproc.
+  PropsObject(int number, const char* label)
+  : Glib::ObjectBase(nullptr),
+    Glib::Object(Glib::ConstructParams(props_object_class_.init(),
+      "number", number, "label", label, nullptr))
+  {
+  }
+
+private:
+  static PropsObject_Class props_object_class_;
+};
+
+PropsObject_Class PropsObject::props_object_class_;
+
+// A custom type with custom properties.
+class Point : public Glib::Object
+{
+public:
+  Point()
+  : Glib::ObjectBase("BenchPoint"),
+    x_(*this, "x", 0),
+    label_(*this, "label", ""),
+    y_(*this, "y", 0, "", "", Glib::ParamFlags::EXPLICIT_NOTIFY)
+  {
+  }
+
+  Glib::PropertyProxy<int> property_x() { return x_.get_proxy(); }
+  Glib::PropertyProxy<Glib::ustring> property_label() { return label_.get_proxy(); }
+  Glib::PropertyProxy<int> property_y() { return y_.get_proxy(); }
+
+private:
+  Glib::Property<int> x_;
+  Glib::Property<Glib::ustring> label_;
+  Glib::Property<int> y_;
+};
+
+struct Pair
+{
+  int x;
+  int y;
+};
+
+struct InlinePair
+{
+  int x;
+  int y;
+};
+
+} // anonymous namespace
+
+namespace Glib
+{
+namespace Traits
+{
+template <>
+struct ValueInlineStorage<InlinePair> : std::true_type
+{
+};
+} // namespace Traits
+} // namespace Glib
+
+int
+main(int argc, char** argv)
+{
+  Bench::Runner runner("object", argc, argv);
+
+  // Construction
+
+  runner.add("g_object_new_unref", [](Bench::State& state) {
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+    {
+      gpointer object = g_object_new(bench_props_get_type(),
+        "number", static_cast<int>(i), "label", "label", nullptr);
+      g_object_unref(object);
+    }
+  });
+
+  runner.add("construct_params", [](Bench::State& state) {
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+    {
+      PropsObject object(static_cast<int>(i), "label");
+      Bench::do_not_optimize(object);
+    }
+  });
+
+  runner.add("stack_construct_params", [](Bench::State& state) {
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+    {
+      PropsObject object(static_cast<int>(i), "label", true);
+      Bench::do_not_optimize(object);
+    }
+  });
+
+  runner.add("custom_type_create", [](Bench::State& state) {
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+    {
+      auto point = Glib::make_refptr_for_instance(new Point());
+      Bench::do_not_optimize(point);
+    }
+  });
+
+  runner.add("custom_type_create_1000", [](Bench::State& state) {
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+    {
+      std::vector<Glib::RefPtr<Point>> points;
+      points.reserve(1000);
+      for (int j = 0; j < 1000; ++j)
+        points.push_back(Glib::make_refptr_for_instance(new Point()));
+      Bench::do_not_optimize(points);
+    }
+    state.set_items_per_iteration(1000);
+  });
+
+  // Glib::wrap()
+
+  runner.add("wrap_new_wrapper", [](Bench::State& state) {
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+    {
+      auto object = Glib::wrap(G_OBJECT(g_object_new(G_TYPE_OBJECT, nullptr)));
+      Bench::do_not_optimize(object);
+    }
+  });
+
+  runner.add("wrap_existing_wrapper", [](Bench::State& state) {
+    auto point = Glib::make_refptr_for_instance(new Point());
+    GObject* const gobject = point->gobj();
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+    {
+      auto object = Glib::wrap(gobject, true);
+      Bench::do_not_optimize(object);
+    }
+  });
+
+  // Properties
+
+  runner.add("property_g_object_set", [](Bench::State& state) {
+    auto point = Glib::make_refptr_for_instance(new Point());
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+      g_object_set(point->gobj(), "x", static_cast<int>(i), nullptr);
+  });
+
+  runner.add("property_proxy_set", [](Bench::State& state) {
+    auto point = Glib::make_refptr_for_instance(new Point());
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+      point->property_x() = static_cast<int>(i);
+  });
+
+  runner.add("property_proxy_get", [](Bench::State& state) {
+    auto point = Glib::make_refptr_for_instance(new Point());
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+      Bench::do_not_optimize(point->property_x().get_value());
+  });
+
+  runner.add("property_by_name_set", [](Bench::State& state) {
+    auto point = Glib::make_refptr_for_instance(new Point());
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+      point->set_property("x", static_cast<int>(i));
+  });
+
+  runner.add("property_id_set", [](Bench::State& state) {
+    auto point = Glib::make_refptr_for_instance(new Point());
+    const Glib::PropertyId<int> x_id(G_OBJECT_TYPE(point->gobj()), "x");
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+      point->set_property(x_id, static_cast<int>(i));
+  });
+
+  runner.add("property_id_get", [](Bench::State& state) {
+    auto point = Glib::make_refptr_for_instance(new Point());
+    const Glib::PropertyId<int> x_id(G_OBJECT_TYPE(point->gobj()), "x");
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+      Bench::do_not_optimize(point->get_property(x_id));
+  });
+
+  runner.add("property_ustring_set", [](Bench::State& state) {
+    auto point = Glib::make_refptr_for_instance(new Point());
+    const Glib::ustring labels[] = { "first label", "second label" };
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+      point->property_label() = labels[i % 2];
+  });
+
+  // Setting the same value of an EXPLICIT_NOTIFY property emits no notify signal.
+  runner.add("property_set_unchanged_explicit_notify", [](Bench::State& state) {
+    auto point = Glib::make_refptr_for_instance(new Point());
+    int n_notified = 0;
+    point->property_y().signal_changed().connect([&n_notified]() { ++n_notified; });
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+      point->property_y() = 1;
+    Bench::do_not_optimize(n_notified);
+  });
+
+  runner.add("property_set_notify_10", [](Bench::State& state) {
+    auto point = Glib::make_refptr_for_instance(new Point());
+    int n_notified = 0;
+    point->property_x().signal_changed().connect([&n_notified]() { ++n_notified; });
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+      for (int j = 0; j < 10; ++j)
+        point->property_x() = j;
+    Bench::do_not_optimize(n_notified);
+  });
+
+  runner.add("property_set_notify_batch_10", [](Bench::State& state) {
+    auto point = Glib::make_refptr_for_instance(new Point());
+    int n_notified = 0;
+    point->property_x().signal_changed().connect([&n_notified]() { ++n_notified; });
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+    {
+      Glib::NotifyBatch batch(*point);
+      for (int j = 0; j < 10; ++j)
+        point->property_x() = j;
+    }
+    Bench::do_not_optimize(n_notified);
+  });
+
+  // Glib::Value
+
+  runner.add("value_int_roundtrip", [](Bench::State& state) {
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+    {
+      Glib::Value<int> value;
+      value.init(Glib::Value<int>::value_type());
+      value.set(static_cast<int>(i));
+      Bench::do_not_optimize(value.get());
+    }
+  });
+
+  runner.add("value_ustring_roundtrip", [](Bench::State& state) {
+    const Glib::ustring str = "A string value";
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+    {
+      Glib::Value<Glib::ustring> value;
+      value.init(Glib::Value<Glib::ustring>::value_type());
+      value.set(str);
+      Glib::ustring result = value.get();
+      Bench::do_not_optimize(result);
+    }
+  });
+
+  runner.add("value_custom_heap_roundtrip", [](Bench::State& state) {
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+    {
+      Glib::Value<Pair> value;
+      value.init(Glib::Value<Pair>::value_type());
+      value.set(Pair{ static_cast<int>(i), 2 });
+      Glib::Value<Pair> copy(value);
+      Bench::do_not_optimize(copy.get());
+    }
+  });
+
+  runner.add("value_custom_inline_roundtrip", [](Bench::State& state) {
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+    {
+      Glib::Value<InlinePair> value;
+      value.init(Glib::Value<InlinePair>::value_type());
+      value.set(InlinePair{ static_cast<int>(i), 2 });
+      Glib::Value<InlinePair> copy(value);
+      Bench::do_not_optimize(copy.get());
+    }
+  });
+
+  return runner.run();
+}
@@ -0,0 +1,114 @@
+/* Copyright (C) 2026 The glibmm Development Team
+ *
+ * This file is part of glibmm.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Random number generators: Glib::Rand, Glib::Xoshiro256, Glib::Pcg32 and,
+// as a baseline, std::mt19937.
+
+#include "benchmark.h"
+#include <glibmm.h>
+#include <random>
+#include <vector>
+
+namespace
+{
+
+constexpr std::size_t n_numbers = 4096;
+constexpr guint32 seed = 42;
+
+template <class Generator>
+void
+add_generator_benchmarks(Bench::Runner& runner, const std::string& name)
+{
+  runner.add(name + "_get_int", [](Bench::State& state) {
+    Generator generator(seed);
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+      Bench::do_not_optimize(generator.get_int());
+  });
+
+  runner.add(name + "_get_double", [](Bench::State& state) {
+    Generator generator(seed);
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+      Bench::do_not_optimize(generator.get_double());
+  });
+
+  runner.add(name + "_fill_int_4096", [](Bench::State& state) {
+    Generator generator(seed);
+    std::vector<guint32> numbers(n_numbers);
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+    {
+      generator.fill(numbers);
+      Bench::clobber_memory();
+    }
+    state.set_items_per_iteration(n_numbers);
+  });
+
+  runner.add(name + "_fill_double_4096", [](Bench::State& state) {
+    Generator generator(seed);
+    std::vector<double> numbers(n_numbers);
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+    {
+      generator.fill(numbers);
+      Bench::clobber_memory();
+    }
+    state.set_items_per_iteration(n_numbers);
+  });
+
+  runner.add(name + "_uniform_int_distribution", [](Bench::State& state) {
+    Generator generator(seed);
+    std::uniform_int_distribution<int> distribution(1, 6);
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+      Bench::do_not_optimize(distribution(generator));
+  });
+}
+
+} // anonymous namespace
+
+int
+main(int argc, char** argv)
+{
+  Bench::Runner runner("random", argc, argv);
+
+  add_generator_benchmarks<Glib::Rand>(runner, "rand");
+  add_generator_benchmarks<Glib::Xoshiro256>(runner, "xoshiro256");
+  add_generator_benchmarks<Glib::Pcg32>(runner, "pcg32");
+
+  runner.add("g_random_int", [](Bench::State& state) {
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+      Bench::do_not_optimize(g_random_int());
+  });
+
+  runner.add("xoshiro256_thread_default_get_int", [](Bench::State& state) {
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+      Bench::do_not_optimize(Glib::Xoshiro256::get_thread_default().get_int());
+  });
+
+  runner.add("mt19937_get_int", [](Bench::State& state) {
+    std::mt19937 generator(seed);
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+      Bench::do_not_optimize(generator());
+  });
+
+  runner.add("mt19937_uniform_real_distribution", [](Bench::State& state) {
+    std::mt19937 generator(seed);
+    std::uniform_real_distribution<double> distribution;
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+      Bench::do_not_optimize(distribution(generator));
+  });
+
+  return runner.run();
+}
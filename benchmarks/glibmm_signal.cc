@@ -0,0 +1,154 @@
+/* Copyright (C) 2026 The glibmm Development Team
+ *
+ * This file is part of glibmm.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// sigc++ signals, and GObject signals through glibmm's signal proxies.
+
+#include "benchmark.h"
+#include <vector>
+
+namespace
+{
+
+class Counter : public Glib::Object
+{
+public:
+  Counter() : Glib::ObjectBase("BenchCounter"), count_(*this, "count", 0) {}
+
+  Glib::PropertyProxy<int> property_count() { return count_.get_proxy(); }
+
+private:
+  Glib::Property<int> count_;
+};
+
+class Receiver : public sigc::trackable
+{
+public:
+  void on_signal(int value) { sum += value; }
+
+  int sum = 0;
+};
+
+void
+on_notify_c(GObject*, GParamSpec*, gpointer data)
+{
+  ++*static_cast<int*>(data);
+}
+
+} // anonymous namespace
+
+int
+main(int argc, char** argv)
+{
+  Bench::Runner runner("signal", argc, argv);
+
+  runner.add("sigc_connect_disconnect", [](Bench::State& state) {
+    sigc::signal<void(int)> signal;
+    int sum = 0;
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+    {
+      auto connection = signal.connect([&sum](int value) { sum += value; });
+      connection.disconnect();
+    }
+    Bench::do_not_optimize(sum);
+  });
+
+  runner.add("sigc_emit_1_slot", [](Bench::State& state) {
+    sigc::signal<void(int)> signal;
+    int sum = 0;
+    signal.connect([&sum](int value) { sum += value; });
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+      signal.emit(1);
+    Bench::do_not_optimize(sum);
+  });
+
+  runner.add("sigc_emit_10_slots", [](Bench::State& state) {
+    sigc::signal<void(int)> signal;
+    int sum = 0;
+    for (int j = 0; j < 10; ++j)
+      signal.connect([&sum](int value) { sum += value; });
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+      signal.emit(1);
+    Bench::do_not_optimize(sum);
+    state.set_items_per_iteration(10);
+  });
+
+  runner.add("sigc_emit_mem_fun_trackable", [](Bench::State& state) {
+    sigc::signal<void(int)> signal;
+    Receiver receiver;
+    signal.connect(sigc::mem_fun(receiver, &Receiver::on_signal));
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+      signal.emit(1);
+    Bench::do_not_optimize(receiver.sum);
+  });
+
+  // GObject signals. The notify signal is emitted directly with
+  // g_object_notify(), so that only the signal emission is measured.
+
+  runner.add("gobject_connect_disconnect_c", [](Bench::State& state) {
+    auto counter = Glib::make_refptr_for_instance(new Counter());
+    int n_notified = 0;
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+    {
+      const gulong handler_id = g_signal_connect(counter->gobj(), "notify::count",
+        G_CALLBACK(&on_notify_c), &n_notified);
+      g_signal_handler_disconnect(counter->gobj(), handler_id);
+    }
+  });
+
+  runner.add("gobject_connect_disconnect_proxy", [](Bench::State& state) {
+    auto counter = Glib::make_refptr_for_instance(new Counter());
+    int n_notified = 0;
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+    {
+      auto connection =
+        counter->property_count().signal_changed().connect([&n_notified]() { ++n_notified; });
+      connection.disconnect();
+    }
+  });
+
+  runner.add("gobject_emit_c", [](Bench::State& state) {
+    auto counter = Glib::make_refptr_for_instance(new Counter());
+    int n_notified = 0;
+    g_signal_connect(counter->gobj(), "notify::count", G_CALLBACK(&on_notify_c), &n_notified);
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+      g_object_notify(counter->gobj(), "count");
+    Bench::do_not_optimize(n_notified);
+  });
+
+  runner.add("gobject_emit_proxy", [](Bench::State& state) {
+    auto counter = Glib::make_refptr_for_instance(new Counter());
+    int n_notified = 0;
+    counter->property_count().signal_changed().connect([&n_notified]() { ++n_notified; });
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+      g_object_notify(counter->gobj(), "count");
+    Bench::do_not_optimize(n_notified);
+  });
+
+  runner.add("gobject_emit_proxy_10_slots", [](Bench::State& state) {
+    auto counter = Glib::make_refptr_for_instance(new Counter());
+    int n_notified = 0;
+    for (int j = 0; j < 10; ++j)
+      counter->property_count().signal_changed().connect([&n_notified]() { ++n_notified; });
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+      g_object_notify(counter->gobj(), "count");
+    Bench::do_not_optimize(n_notified);
+    state.set_items_per_iteration(10);
+  });
+
+  return runner.run();
+}
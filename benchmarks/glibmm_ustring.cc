@@ -0,0 +1,202 @@
+/* Copyright (C) 2026 The glibmm Development Team
+ *
+ * This file is part of glibmm.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Glib::ustring operations. Most of them convert between byte offsets and
+// character offsets, or call into GLib's UTF-8 functions.
+
+#include "benchmark.h"
+#include <glibmm/ustring_hash.h>
+#include <functional>
+
+namespace
+{
+
+// About 4 KiB of mixed ASCII and multibyte text.
+Glib::ustring
+make_text()
+{
+  Glib::ustring text;
+  for (int i = 0; i < 64; ++i)
+    text += "The quick brown fox – «Fuchs» über Ärger – 快速的狐狸 jumps. ";
+  return text;
+}
+
+} // anonymous namespace
+
+int
+main(int argc, char** argv)
+{
+  Bench::Runner runner("ustring", argc, argv);
+  const Glib::ustring text = make_text();
+  const Glib::ustring ascii_text(text.size(), 'x');
+
+  runner.add("construct_short", [](Bench::State& state) {
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+    {
+      Glib::ustring str("short string");
+      Bench::do_not_optimize(str);
+    }
+  });
+
+  runner.add("copy_4k", [&text](Bench::State& state) {
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+    {
+      Glib::ustring str(text);
+      Bench::do_not_optimize(str);
+    }
+    state.set_bytes_per_iteration(text.bytes());
+  });
+
+  runner.add("length_ascii_4k", [&ascii_text](Bench::State& state) {
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+      Bench::do_not_optimize(ascii_text.length());
+    state.set_bytes_per_iteration(ascii_text.bytes());
+  });
+
+  runner.add("length_utf8_4k", [&text](Bench::State& state) {
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+      Bench::do_not_optimize(text.length());
+    state.set_bytes_per_iteration(text.bytes());
+  });
+
+  runner.add("iterate_utf8_4k", [&text](Bench::State& state) {
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+    {
+      gunichar sum = 0;
+      for (const gunichar c : text)
+        sum += c;
+      Bench::do_not_optimize(sum);
+    }
+    state.set_bytes_per_iteration(text.bytes());
+  });
+
+  runner.add("index_middle_utf8", [&text](Bench::State& state) {
+    const auto middle = text.length() / 2;
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+      Bench::do_not_optimize(text[middle]);
+  });
+
+  runner.add("find_utf8", [&text](Bench::State& state) {
+    const Glib::ustring needle = "狐狸 jumps. The end";
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+      Bench::do_not_optimize(text.find(needle));
+    state.set_bytes_per_iteration(text.bytes());
+  });
+
+  runner.add("substr_utf8", [&text](Bench::State& state) {
+    const auto middle = text.length() / 2;
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+    {
+      Glib::ustring str = text.substr(middle, 20);
+      Bench::do_not_optimize(str);
+    }
+  });
+
+  runner.add("compare_collate", [&text](Bench::State& state) {
+    Glib::ustring other = text;
+    other.replace(other.length() - 1, 1, "!");
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+      Bench::do_not_optimize(text.compare(other));
+    state.set_bytes_per_iteration(text.bytes());
+  });
+
+  runner.add("equal_raw", [&text](Bench::State& state) {
+    Glib::ustring other = text;
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+      Bench::do_not_optimize(text.raw() == other.raw());
+    state.set_bytes_per_iteration(text.bytes());
+  });
+
+  runner.add("hash", [&text](Bench::State& state) {
+    const std::hash<Glib::ustring> hash;
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+      Bench::do_not_optimize(hash(text));
+    state.set_bytes_per_iteration(text.bytes());
+  });
+
+  runner.add("validate", [&text](Bench::State& state) {
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+      Bench::do_not_optimize(text.validate());
+    state.set_bytes_per_iteration(text.bytes());
+  });
+
+  runner.add("make_valid", [&text](Bench::State& state) {
+    std::string invalid = text.raw();
+    invalid[invalid.size() / 2] = '\xff';
+    const Glib::ustring invalid_text(invalid);
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+    {
+      Glib::ustring str = invalid_text.make_valid();
+      Bench::do_not_optimize(str);
+    }
+    state.set_bytes_per_iteration(text.bytes());
+  });
+
+  runner.add("uppercase", [&text](Bench::State& state) {
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+    {
+      Glib::ustring str = text.uppercase();
+      Bench::do_not_optimize(str);
+    }
+    state.set_bytes_per_iteration(text.bytes());
+  });
+
+  runner.add("casefold", [&text](Bench::State& state) {
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+    {
+      Glib::ustring str = text.casefold();
+      Bench::do_not_optimize(str);
+    }
+    state.set_bytes_per_iteration(text.bytes());
+  });
+
+  runner.add("normalize_nfc", [&text](Bench::State& state) {
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+    {
+      Glib::ustring str = text.normalize(Glib::NormalizeMode::NFC);
+      Bench::do_not_optimize(str);
+    }
+    state.set_bytes_per_iteration(text.bytes());
+  });
+
+  runner.add("compose", [](Bench::State& state) {
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+    {
+      Glib::ustring str = Glib::ustring::compose("%1 of %2 items in %3", i, 1000, "folder");
+      Bench::do_not_optimize(str);
+    }
+  });
+
+  runner.add("format", [](Bench::State& state) {
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+    {
+      Glib::ustring str = Glib::ustring::format(i, ' ', 2.5);
+      Bench::do_not_optimize(str);
+    }
+  });
+
+  runner.add("sprintf", [](Bench::State& state) {
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+    {
+      Glib::ustring str = Glib::ustring::sprintf("%u of %d items in %s", static_cast<unsigned int>(i), 1000, "folder");
+      Bench::do_not_optimize(str);
+    }
+  });
+
+  return runner.run();
+}
@@ -0,0 +1,191 @@
+/* Copyright (C) 2026 The glibmm Development Team
+ *
+ * This file is part of glibmm.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Glib::Variant creation (serialization) and get() (deserialization).
+
+#include "benchmark.h"
+#include <map>
+#include <tuple>
+#include <vector>
+
+namespace
+{
+
+using Map = std::map<Glib::ustring, int>;
+using Tuple = std::tuple<int, Glib::ustring, bool, double>;
+
+Map
+make_map()
+{
+  Map map;
+  for (int i = 0; i < 100; ++i)
+    map.emplace(Glib::ustring::compose("key-%1", i), i);
+  return map;
+}
+
+std::vector<Glib::ustring>
+make_strings()
+{
+  std::vector<Glib::ustring> strings;
+  for (int i = 0; i < 100; ++i)
+    strings.push_back(Glib::ustring::compose("string number %1", i));
+  return strings;
+}
+
+} // anonymous namespace
+
+int
+main(int argc, char** argv)
+{
+  Bench::Runner runner("variant", argc, argv);
+  const Map map = make_map();
+  const std::vector<Glib::ustring> strings = make_strings();
+  std::vector<int> ints(1000);
+  for (std::size_t i = 0; i < ints.size(); ++i)
+    ints[i] = static_cast<int>(i);
+
+  runner.add("int_create", [](Bench::State& state) {
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+    {
+      auto variant = Glib::Variant<int>::create(static_cast<int>(i));
+      Bench::do_not_optimize(variant);
+    }
+  });
+
+  runner.add("int_get", [](Bench::State& state) {
+    const auto variant = Glib::Variant<int>::create(42);
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+      Bench::do_not_optimize(variant.get());
+  });
+
+  runner.add("ustring_create_get", [](Bench::State& state) {
+    const Glib::ustring str = "A string of moderate length";
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+    {
+      auto variant = Glib::Variant<Glib::ustring>::create(str);
+      Glib::ustring result = variant.get();
+      Bench::do_not_optimize(result);
+    }
+  });
+
+  runner.add("int_array_1000_create", [&ints](Bench::State& state) {
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+    {
+      auto variant = Glib::Variant<std::vector<int>>::create(ints);
+      Bench::do_not_optimize(variant);
+    }
+    state.set_items_per_iteration(ints.size());
+  });
+
+  runner.add("int_array_1000_get", [&ints](Bench::State& state) {
+    const auto variant = Glib::Variant<std::vector<int>>::create(ints);
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+    {
+      std::vector<int> result = variant.get();
+      Bench::do_not_optimize(result);
+    }
+    state.set_items_per_iteration(ints.size());
+  });
+
+  runner.add("string_array_100_create", [&strings](Bench::State& state) {
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+    {
+      auto variant = Glib::Variant<std::vector<Glib::ustring>>::create(strings);
+      Bench::do_not_optimize(variant);
+    }
+    state.set_items_per_iteration(strings.size());
+  });
+
+  runner.add("string_array_100_get", [&strings](Bench::State& state) {
+    const auto variant = Glib::Variant<std::vector<Glib::ustring>>::create(strings);
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+    {
+      std::vector<Glib::ustring> result = variant.get();
+      Bench::do_not_optimize(result);
+    }
+    state.set_items_per_iteration(strings.size());
+  });
+
+  runner.add("map_100_create", [&map](Bench::State& state) {
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+    {
+      auto variant = Glib::Variant<Map>::create(map);
+      Bench::do_not_optimize(variant);
+    }
+    state.set_items_per_iteration(map.size());
+  });
+
+  runner.add("map_100_get", [&map](Bench::State& state) {
+    const auto variant = Glib::Variant<Map>::create(map);
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+    {
+      Map result = variant.get();
+      Bench::do_not_optimize(result);
+    }
+    state.set_items_per_iteration(map.size());
+  });
+
+  runner.add("tuple_create_get", [](Bench::State& state) {
+    const Tuple tuple{42, "text", true, 2.5};
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+    {
+      auto variant = Glib::Variant<Tuple>::create(tuple);
+      Tuple result = variant.get();
+      Bench::do_not_optimize(result);
+    }
+  });
+
+  // Serialization to and from bytes, as for D-Bus messages or GSettings.
+  runner.add("map_100_store", [&map](Bench::State& state) {
+    const auto variant = Glib::Variant<Map>::create(map);
+    std::vector<char> buffer(variant.get_size());
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+    {
+      const auto copy = Glib::Variant<Map>::create(map);
+      copy.store(buffer.data());
+      Bench::clobber_memory();
+    }
+    state.set_bytes_per_iteration(buffer.size());
+  });
+
+  runner.add("map_100_load", [&map](Bench::State& state) {
+    const auto variant = Glib::Variant<Map>::create(map);
+    std::vector<char> buffer(variant.get_size());
+    variant.store(buffer.data());
+    const Glib::VariantType type = variant.get_type();
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+    {
+      const Glib::VariantBase base(
+        g_variant_new_from_data(type.gobj(), buffer.data(), buffer.size(), false, nullptr, nullptr));
+      Map result = Glib::VariantBase::cast_dynamic<Glib::Variant<Map>>(base).get();
+      Bench::do_not_optimize(result);
+    }
+    state.set_bytes_per_iteration(buffer.size());
+  });
+
+  runner.add("map_100_print", [&map](Bench::State& state) {
+    const auto variant = Glib::Variant<Map>::create(map);
+    for (std::size_t i = 0; i < state.iterations(); ++i)
+    {
+      Glib::ustring text = variant.print();
+      Bench::do_not_optimize(text);
+    }
+  });
+
+  return runner.run();
+}
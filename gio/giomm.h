@@ -71,6 +71,7 @@
 #if !defined(G_OS_WIN32) && !defined(GLIBMM_OS_COCOA)
 #include <giomm/desktopappinfo.h>
 #endif
+#include <giomm/directorywalker.h>
 #include <giomm/drive.h>
 #include <giomm/emblem.h>
 #include <giomm/emblemedicon.h>
@@ -111,6 +112,7 @@
 #include <giomm/menumodel.h>
 #include <giomm/mount.h>
 #include <giomm/mountoperation.h>
+#include <giomm/multiloopsocketservice.h>
 #include <giomm/networkaddress.h>
 #include <giomm/networkmonitor.h>
 #include <giomm/networkservice.h>
@@ -128,6 +130,7 @@
 #include <giomm/resource.h>
 #include <giomm/seekable.h>
 #include <giomm/settings.h>
+#include <giomm/settingscache.h>
 #include <giomm/settingsschema.h>
 #include <giomm/settingsschemakey.h>
 #include <giomm/settingsschemasource.h>
@@ -0,0 +1,459 @@
+/* Copyright (C) 2026 The giomm Development Team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <giomm/directorywalker.h>
+#include <giomm/asyncresult.h>
+#include <giomm/error.h>
+#include <giomm/fileenumerator.h>
+#include <glibmm/exceptionhandler.h>
+#include <gio/gio.h>
+#include <utility>
+
+namespace Gio
+{
+
+struct DirectoryWalker::Impl : public std::enable_shared_from_this<DirectoryWalker::Impl>
+{
+  struct Directory
+  {
+    DirectoryStats stats;
+    gint64 start_time = 0;
+    Glib::RefPtr<FileEnumerator> enumerator;
+  };
+  using DirectoryPtr = std::shared_ptr<Directory>;
+
+  Impl(const std::string& attributes_in, FileQueryInfoFlags flags_in);
+
+  bool is_cancelled() const { return cancellable && cancellable->is_cancelled(); }
+
+  void open_directories();
+  void open_directory(const Glib::RefPtr<File>& file, unsigned int depth);
+  void on_directory_opened(Glib::RefPtr<AsyncResult>& result, const DirectoryPtr& dir);
+  void request_batch(const DirectoryPtr& dir);
+  void on_batch_ready(Glib::RefPtr<AsyncResult>& result, const DirectoryPtr& dir);
+  void close_directory(const DirectoryPtr& dir);
+  void on_directory_closed(const DirectoryPtr& dir);
+  void close_parked_directories();
+  void report_error(const Glib::RefPtr<File>& file, const Glib::Error& error);
+  void finish_if_done();
+
+  std::string attributes;
+  FileQueryInfoFlags flags;
+  unsigned int max_parallel = 8;
+  int batch_size = 256;
+  int max_depth = -1;
+  int io_priority = Glib::PRIORITY_DEFAULT;
+
+  // Directories that have been found but not yet opened.
+  // It's used as a stack. That keeps the walk mostly depth-first,
+  // and the number of waiting directories small.
+  std::vector<std::pair<Glib::RefPtr<File>, unsigned int>> pending;
+
+  // Open directories that wait for resume().
+  std::vector<DirectoryPtr> parked;
+
+  // Number of directories from enumerate_children_async() until closed.
+  unsigned int n_open = 0;
+
+  bool running = false;
+  bool paused = false;
+  // The DirectoryWalker has been deleted. Outstanding operations shall
+  // complete without calling any user code.
+  bool detached = false;
+
+  Glib::RefPtr<Cancellable> cancellable;
+  SlotEntries slot_entries;
+  SlotFinished slot_finished;
+  sigc::signal<void(const DirectoryStats&)> signal_directory_done;
+  sigc::signal<void(const Glib::RefPtr<File>&, const Glib::Error&)> signal_error;
+};
+
+DirectoryWalker::Impl::Impl(const std::string& attributes_in, FileQueryInfoFlags flags_in)
+: flags(flags_in)
+{
+  // The walker itself needs the name (for FileEnumerator::get_child())
+  // and the type (to find subdirectories). Duplicated attributes are harmless.
+  if (attributes_in.empty())
+    attributes = "standard::name,standard::type";
+  else
+    attributes = attributes_in + ",standard::name,standard::type";
+}
+
+void
+DirectoryWalker::Impl::open_directories()
+{
+  while (!paused && !is_cancelled() && n_open < max_parallel && !pending.empty())
+  {
+    auto next = std::move(pending.back());
+    pending.pop_back();
+    open_directory(next.first, next.second);
+  }
+}
+
+void
+DirectoryWalker::Impl::open_directory(const Glib::RefPtr<File>& file, unsigned int depth)
+{
+  auto dir = std::make_shared<Directory>();
+  dir->stats.directory = file;
+  dir->stats.depth = depth;
+  dir->start_time = g_get_monotonic_time();
+  ++n_open;
+
+  auto self = shared_from_this();
+  file->enumerate_children_async(
+    [self, dir](Glib::RefPtr<AsyncResult>& result) { self->on_directory_opened(result, dir); },
+    cancellable, attributes, flags, io_priority);
+}
+
+void
+DirectoryWalker::Impl::on_directory_opened(Glib::RefPtr<AsyncResult>& result, const DirectoryPtr& dir)
+{
+  try
+  {
+    dir->enumerator = dir->stats.directory->enumerate_children_finish(result);
+  }
+  catch (const Glib::Error& ex)
+  {
+    --n_open;
+    if (!ex.matches(G_IO_ERROR, G_IO_ERROR_CANCELLED))
+      report_error(dir->stats.directory, ex);
+    open_directories();
+    finish_if_done();
+    return;
+  }
+
+  request_batch(dir);
+}
+
+void
+DirectoryWalker::Impl::request_batch(const DirectoryPtr& dir)
+{
+  if (is_cancelled())
+  {
+    close_directory(dir);
+    return;
+  }
+
+  auto self = shared_from_this();
+  dir->enumerator->next_files_async(
+    [self, dir](Glib::RefPtr<AsyncResult>& result) { self->on_batch_ready(result, dir); },
+    cancellable, batch_size, io_priority);
+}
+
+void
+DirectoryWalker::Impl::on_batch_ready(Glib::RefPtr<AsyncResult>& result, const DirectoryPtr& dir)
+{
+  std::vector<Glib::RefPtr<FileInfo>> infos;
+  try
+  {
+    infos = dir->enumerator->next_files_finish(result);
+  }
+  catch (const Glib::Error& ex)
+  {
+    if (!ex.matches(G_IO_ERROR, G_IO_ERROR_CANCELLED))
+      report_error(dir->stats.directory, ex);
+    close_directory(dir);
+    return;
+  }
+
+  if (infos.empty())
+  {
+    // End of directory.
+    close_directory(dir);
+    return;
+  }
+
+  auto& stats = dir->stats;
+  if (stats.n_batches++ == 0)
+    stats.first_batch_usec = g_get_monotonic_time() - dir->start_time;
+  stats.n_entries += infos.size();
+
+  if (max_depth < 0 || stats.depth < static_cast<unsigned int>(max_depth))
+  {
+    for (const auto& info : infos)
+    {
+      if (info->get_file_type() == FileType::DIRECTORY)
+        pending.emplace_back(dir->enumerator->get_child(info), stats.depth + 1);
+    }
+  }
+
+  if (!detached)
+  {
+    try
+    {
+      slot_entries(stats.directory, infos);
+    }
+    catch (...)
+    {
+      Glib::exception_handlers_invoke();
+    }
+  }
+
+  // slot_entries may have called pause() or cancel().
+  if (paused && !is_cancelled())
+    parked.emplace_back(dir);
+  else
+    request_batch(dir);
+
+  open_directories();
+}
+
+void
+DirectoryWalker::Impl::close_directory(const DirectoryPtr& dir)
+{
+  // Don't pass the cancellable. A cancelled close operation would leave
+  // the enumerator open until it's finalized.
+  auto self = shared_from_this();
+  dir->enumerator->close_async(io_priority,
+    [self, dir](Glib::RefPtr<AsyncResult>& result)
+    {
+      try
+      {
+        dir->enumerator->close_finish(result);
+      }
+      catch (const Glib::Error&)
+      {
+        // The directory has been read. A failing close() is not worth reporting.
+      }
+      self->on_directory_closed(dir);
+    });
+}
+
+void
+DirectoryWalker::Impl::on_directory_closed(const DirectoryPtr& dir)
+{
+  --n_open;
+  dir->enumerator.reset();
+  dir->stats.elapsed_usec = g_get_monotonic_time() - dir->start_time;
+
+  if (!detached)
+  {
+    try
+    {
+      signal_directory_done.emit(dir->stats);
+    }
+    catch (...)
+    {
+      Glib::exception_handlers_invoke();
+    }
+  }
+
+  open_directories();
+  finish_if_done();
+}
+
+void
+DirectoryWalker::Impl::close_parked_directories()
+{
+  auto to_close = std::move(parked);
+  parked.clear();
+  for (const auto& dir : to_close)
+    close_directory(dir);
+}
+
+void
+DirectoryWalker::Impl::report_error(const Glib::RefPtr<File>& file, const Glib::Error& error)
+{
+  if (detached)
+    return;
+
+  try
+  {
+    signal_error.emit(file, error);
+  }
+  catch (...)
+  {
+    Glib::exception_handlers_invoke();
+  }
+}
+
+void
+DirectoryWalker::Impl::finish_if_done()
+{
+  if (!running || n_open > 0 || !parked.empty())
+    return;
+
+  if (is_cancelled())
+    pending.clear();
+  else if (!pending.empty())
+    return;
+
+  running = false;
+  paused = false;
+  cancellable.reset();
+  slot_entries = {};
+
+  // Move the slot out first. It may start a new walk.
+  auto slot = std::move(slot_finished);
+  slot_finished = {};
+  if (detached)
+    return;
+
+  try
+  {
+    slot();
+  }
+  catch (...)
+  {
+    Glib::exception_handlers_invoke();
+  }
+}
+
+DirectoryWalker::DirectoryWalker(const std::string& attributes, FileQueryInfoFlags flags)
+: impl_(std::make_shared<Impl>(attributes, flags))
+{
+}
+
+DirectoryWalker::~DirectoryWalker() noexcept
+{
+  impl_->detached = true;
+  impl_->slot_entries = {};
+  impl_->slot_finished = {};
+  impl_->signal_directory_done.clear();
+  impl_->signal_error.clear();
+
+  if (impl_->running)
+  {
+    impl_->cancellable->cancel();
+    impl_->pending.clear();
+    impl_->close_parked_directories();
+  }
+}
+
+void
+DirectoryWalker::set_max_parallel(unsigned int max_parallel)
+{
+  impl_->max_parallel = max_parallel > 0 ? max_parallel : 1;
+  if (impl_->running)
+    impl_->open_directories();
+}
+
+unsigned int
+DirectoryWalker::get_max_parallel() const
+{
+  return impl_->max_parallel;
+}
+
+void
+DirectoryWalker::set_batch_size(int batch_size)
+{
+  impl_->batch_size = batch_size > 0 ? batch_size : 1;
+}
+
+int
+DirectoryWalker::get_batch_size() const
+{
+  return impl_->batch_size;
+}
+
+void
+DirectoryWalker::set_max_depth(int max_depth)
+{
+  impl_->max_depth = max_depth;
+}
+
+int
+DirectoryWalker::get_max_depth() const
+{
+  return impl_->max_depth;
+}
+
+void
+DirectoryWalker::set_io_priority(int io_priority)
+{
+  impl_->io_priority = io_priority;
+}
+
+int
+DirectoryWalker::get_io_priority() const
+{
+  return impl_->io_priority;
+}
+
+void
+DirectoryWalker::walk_async(const Glib::RefPtr<File>& root, const SlotEntries& slot_entries,
+  const SlotFinished& slot_finished, const Glib::RefPtr<Cancellable>& cancellable)
+{
+  if (impl_->running)
+    throw Gio::Error(Gio::Error::PENDING, "DirectoryWalker::walk_async(): A walk is already running.");
+
+  impl_->running = true;
+  impl_->paused = false;
+  impl_->slot_entries = slot_entries;
+  impl_->slot_finished = slot_finished;
+  impl_->cancellable = cancellable ? cancellable : Cancellable::create();
+  impl_->open_directory(root, 0);
+}
+
+void
+DirectoryWalker::cancel()
+{
+  if (!impl_->running)
+    return;
+
+  impl_->cancellable->cancel();
+  impl_->pending.clear();
+  impl_->close_parked_directories();
+  impl_->finish_if_done();
+}
+
+void
+DirectoryWalker::pause()
+{
+  if (impl_->running)
+    impl_->paused = true;
+}
+
+void
+DirectoryWalker::resume()
+{
+  if (!impl_->paused)
+    return;
+
+  impl_->paused = false;
+  auto to_resume = std::move(impl_->parked);
+  impl_->parked.clear();
+  for (const auto& dir : to_resume)
+    impl_->request_batch(dir);
+  impl_->open_directories();
+  impl_->finish_if_done();
+}
+
+bool
+DirectoryWalker::is_paused() const
+{
+  return impl_->paused;
+}
+
+bool
+DirectoryWalker::is_running() const
+{
+  return impl_->running;
+}
+
+sigc::signal<void(const DirectoryWalker::DirectoryStats&)>&
+DirectoryWalker::signal_directory_done()
+{
+  return impl_->signal_directory_done;
+}
+
+sigc::signal<void(const Glib::RefPtr<File>&, const Glib::Error&)>&
+DirectoryWalker::signal_error()
+{
+  return impl_->signal_error;
+}
+
+} // namespace Gio
@@ -0,0 +1,211 @@
+#ifndef _GIOMM_DIRECTORYWALKER_H
+#define _GIOMM_DIRECTORYWALKER_H
+
+/* Copyright (C) 2026 The giomm Development Team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <giommconfig.h>
+#include <glibmm/error.h>
+#include <glibmm/priorities.h>
+#include <glibmm/refptr.h>
+#include <giomm/cancellable.h>
+#include <giomm/file.h>
+#include <giomm/fileinfo.h>
+#include <sigc++/sigc++.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Gio
+{
+
+/** Recursively enumerates a directory tree with several directories in flight.
+ *
+ * A plain loop over File::enumerate_children() and FileEnumerator::next_file()
+ * visits one directory at a time and waits for every single entry.
+ * DirectoryWalker instead keeps up to get_max_parallel() directories open
+ * at once and fetches their entries in batches with
+ * FileEnumerator::next_files_async(). GIO performs the blocking file system
+ * calls of these asynchronous operations in its own worker threads, so the
+ * walk is spread over several threads while all callbacks are invoked in the
+ * thread-default main context of the thread that called walk_async().
+ *
+ * The attributes to query are chosen once, when the walker is created.
+ * Entries are delivered in batches, one call of the entries slot per batch
+ * returned by FileEnumerator::next_files_finish(). The consumer can apply
+ * back pressure with pause() and resume(); while the walker is paused,
+ * no new batches are requested and the amount of buffered data is bounded
+ * by get_max_parallel() batches.
+ *
+ * Example:
+ * @code
+ * Gio::DirectoryWalker walker("standard::name,standard::size");
+ * walker.signal_directory_done().connect([](const Gio::DirectoryWalker::DirectoryStats& stats)
+ *   { std::cout << stats.directory->get_path() << ": " << stats.elapsed_usec << " us\n"; });
+ * walker.walk_async(Gio::File::create_for_path("/usr"),
+ *   [](const Glib::RefPtr<Gio::File>& dir, const std::vector<Glib::RefPtr<Gio::FileInfo>>& infos)
+ *   { ... },
+ *   [&mainloop]() { mainloop->quit(); });
+ * mainloop->run();
+ * @endcode
+ *
+ * A DirectoryWalker can run only one walk at a time. It is not thread-safe.
+ * Call its methods only from the thread where walk_async() was called.
+ * If the walker is deleted while a walk is running, the walk is cancelled
+ * and no more slots are invoked.
+ *
+ * @newin{2,90}
+ */
+class GIOMM_API DirectoryWalker
+{
+public:
+  /** Statistics about one enumerated directory.
+   * They are reported by signal_directory_done() when the directory has been
+   * closed.
+   */
+  struct DirectoryStats
+  {
+    /// The enumerated directory.
+    Glib::RefPtr<File> directory;
+    /// Depth below the root directory. The root directory has depth 0.
+    unsigned int depth = 0;
+    /// Number of entries returned by the enumerator.
+    guint64 n_entries = 0;
+    /// Number of next_files_async() batches.
+    unsigned int n_batches = 0;
+    /// Time from the start of the enumeration until the first batch arrived, in microseconds.
+    gint64 first_batch_usec = 0;
+    /// Time from the start of the enumeration until the directory was closed, in microseconds.
+    gint64 elapsed_usec = 0;
+  };
+
+  /** For instance,
+   * void on_entries(const Glib::RefPtr<Gio::File>& directory,
+   *   const std::vector<Glib::RefPtr<Gio::FileInfo>>& infos);
+   */
+  using SlotEntries = sigc::slot<void(const Glib::RefPtr<File>&,
+    const std::vector<Glib::RefPtr<FileInfo>>&)>;
+
+  /** For instance,
+   * void on_finished();
+   */
+  using SlotFinished = sigc::slot<void()>;
+
+  /** Creates a directory walker.
+   *
+   * The attributes <tt>standard::name</tt> and <tt>standard::type</tt> are
+   * always queried in addition to @a attributes, because the walker needs
+   * them to find subdirectories.
+   *
+   * @param attributes The file attributes to query for every entry.
+   * @param flags Flags used when querying the file info.
+   *        By default symbolic links are not followed, which also prevents
+   *        the walker from looping in cyclic directory structures.
+   */
+  explicit DirectoryWalker(const std::string& attributes = "standard::name,standard::type",
+    FileQueryInfoFlags flags = FileQueryInfoFlags::NOFOLLOW_SYMLINKS);
+  ~DirectoryWalker() noexcept;
+
+  // noncopyable
+  DirectoryWalker(const DirectoryWalker&) = delete;
+  DirectoryWalker& operator=(const DirectoryWalker&) = delete;
+
+  /** Sets the maximum number of directories that are enumerated simultaneously.
+   * The default value is 8. A value of 0 is treated as 1.
+   */
+  void set_max_parallel(unsigned int max_parallel);
+  unsigned int get_max_parallel() const;
+
+  /** Sets the number of entries requested per FileEnumerator::next_files_async() call.
+   * The default value is 256.
+   */
+  void set_batch_size(int batch_size);
+  int get_batch_size() const;
+
+  /** Sets the maximum depth of the walk.
+   * 0 means that only the entries of the root directory are reported.
+   * A negative value (the default) means that there is no limit.
+   */
+  void set_max_depth(int max_depth);
+  int get_max_depth() const;
+
+  /** Sets the I/O priority of the asynchronous operations.
+   * The default value is Glib::PRIORITY_DEFAULT.
+   */
+  void set_io_priority(int io_priority);
+  int get_io_priority() const;
+
+  /** Starts walking the tree below @a root.
+   *
+   * @a slot_entries is called for each batch of entries. @a slot_finished is
+   * called once, when all directories have been enumerated or the walk has
+   * been cancelled.
+   *
+   * @param root The root directory.
+   * @param slot_entries A callback that receives the entries of one batch.
+   * @param slot_finished A callback that is called when the walk is finished.
+   * @param cancellable A Cancellable object which can be used to cancel the walk.
+   *
+   * @throw Gio::Error with code PENDING if a walk is already running.
+   */
+  void walk_async(const Glib::RefPtr<File>& root, const SlotEntries& slot_entries,
+    const SlotFinished& slot_finished, const Glib::RefPtr<Cancellable>& cancellable = {});
+
+  /** Cancels a running walk.
+   * The finished slot is called when all outstanding operations have completed.
+   */
+  void cancel();
+
+  /** Stops requesting new batches of entries until resume() is called.
+   * Operations that are already in progress are completed.
+   * If the cancellable passed to walk_async() is cancelled while the walker
+   * is paused, the walk is finished when resume() or cancel() is called.
+   */
+  void pause();
+
+  /// Continues a walk that has been paused with pause().
+  void resume();
+
+  bool is_paused() const;
+  bool is_running() const;
+
+  /** Emitted when a directory has been completely enumerated and closed.
+   *
+   * @par Slot Prototype:
+   * <tt>void on_my_%directory_done(const DirectoryStats& stats)</tt>
+   */
+  sigc::signal<void(const DirectoryStats&)>& signal_directory_done();
+
+  /** Emitted when a directory can't be opened or read.
+   * The walk continues with the remaining directories.
+   * Cancellation is not reported as an error.
+   *
+   * @par Slot Prototype:
+   * <tt>void on_my_%error(const Glib::RefPtr<Gio::File>& directory, const Glib::Error& error)</tt>
+   */
+  sigc::signal<void(const Glib::RefPtr<File>&, const Glib::Error&)>& signal_error();
+
+private:
+  struct Impl;
+
+  // Asynchronous callbacks hold a reference to the Impl object,
+  // so it can outlive the DirectoryWalker.
+  std::shared_ptr<Impl> impl_;
+};
+
+} // namespace Gio
+
+#endif /* _GIOMM_DIRECTORYWALKER_H */
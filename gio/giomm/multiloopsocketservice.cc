@@ -0,0 +1,283 @@
+/* Copyright (C) 2026 The giomm Development Team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <giomm/multiloopsocketservice.h>
+#include <giomm/inetaddress.h>
+#include <giomm/inetsocketaddress.h>
+#include <giomm/socket.h>
+#include <giomm/socketservice.h>
+#include <glibmm/exceptionhandler.h>
+#include <gio/gio.h>
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+#ifndef G_OS_WIN32
+#include <sys/socket.h>
+#endif
+
+// The socket option that makes the kernel distribute incoming connections over
+// several listening sockets on the same port. Other systems, e.g. macOS and
+// OpenBSD, define SO_REUSEPORT, but then one of the sockets gets all connections.
+#if defined(SO_REUSEPORT_LB)
+#define GIOMM_LOAD_BALANCING_REUSEPORT SO_REUSEPORT_LB
+#elif defined(__linux__) && defined(SO_REUSEPORT)
+#define GIOMM_LOAD_BALANCING_REUSEPORT SO_REUSEPORT
+#endif
+
+namespace
+{
+
+struct Counters
+{
+  std::atomic<guint64> accepted{ 0 };
+  std::atomic<guint64> active{ 0 };
+};
+
+extern "C"
+{
+static void
+giomm_multiloopsocketservice_connection_finalized(void* data, GObject*)
+{
+  auto counters = static_cast<std::shared_ptr<Counters>*>(data);
+  --(*counters)->active;
+  delete counters;
+}
+} // extern "C"
+
+Glib::RefPtr<Gio::Socket>
+create_listening_socket(guint16 port)
+{
+  auto family = Gio::SocketFamily::IPV6;
+  Glib::RefPtr<Gio::Socket> socket;
+  try
+  {
+    socket = Gio::Socket::create(family, Gio::Socket::Type::STREAM, Gio::Socket::Protocol::TCP);
+  }
+  catch (const Glib::Error&)
+  {
+    // No IPv6 support.
+    family = Gio::SocketFamily::IPV4;
+    socket = Gio::Socket::create(family, Gio::Socket::Type::STREAM, Gio::Socket::Protocol::TCP);
+  }
+
+#ifdef GIOMM_LOAD_BALANCING_REUSEPORT
+  socket->set_option(SOL_SOCKET, GIOMM_LOAD_BALANCING_REUSEPORT, 1);
+#endif
+
+  socket->bind(
+    Gio::InetSocketAddress::create(Gio::InetAddress::create_any(family), port), true);
+  socket->listen();
+  return socket;
+}
+
+} // anonymous namespace
+
+namespace Gio
+{
+
+struct MultiLoopSocketService::Loop
+{
+  Glib::RefPtr<Glib::MainContext> context = Glib::MainContext::create();
+  Glib::RefPtr<Glib::MainLoop> mainloop = Glib::MainLoop::create(context);
+  std::vector<Glib::RefPtr<Socket>> sockets;
+  // Shared with the weak references of active connections,
+  // which may outlive the service.
+  std::shared_ptr<Counters> counters = std::make_shared<Counters>();
+  SlotIncoming slot;
+  std::thread thread;
+
+  // Round-robin index. Used only by the first loop, if it accepts for all loops.
+  unsigned int next_loop = 0;
+
+  void run(const std::vector<std::unique_ptr<Loop>>& loops);
+  bool handle(const Glib::RefPtr<SocketConnection>& connection,
+    const Glib::RefPtr<Glib::Object>& source_object);
+};
+
+void
+MultiLoopSocketService::Loop::run(const std::vector<std::unique_ptr<Loop>>& loops)
+{
+  // GSocketService attaches its sources to the thread-default context.
+  context->push_thread_default();
+
+  auto service = SocketService::create();
+  for (const auto& socket : sockets)
+    service->add_socket(socket);
+
+  if (has_per_loop_listeners())
+  {
+    service->signal_incoming().connect(sigc::mem_fun(*this, &Loop::handle));
+  }
+  else
+  {
+    service->signal_incoming().connect(
+      [this, &loops](const Glib::RefPtr<SocketConnection>& connection,
+        const Glib::RefPtr<Glib::Object>& source_object) -> bool
+      {
+        Loop* const target = loops[next_loop++ % loops.size()].get();
+        if (target == this)
+          return handle(connection, source_object);
+
+        target->context->invoke([target, connection, source_object]() -> bool
+          {
+            target->handle(connection, source_object);
+            return false;
+          });
+        return true;
+      });
+  }
+
+  mainloop->run();
+
+  // Don't close the service. That would close the listening sockets,
+  // which are reused if start() is called again.
+  service->stop();
+  service.reset();
+  context->pop_thread_default();
+}
+
+bool
+MultiLoopSocketService::Loop::handle(const Glib::RefPtr<SocketConnection>& connection,
+  const Glib::RefPtr<Glib::Object>& source_object)
+{
+  ++counters->accepted;
+  ++counters->active;
+  g_object_weak_ref(G_OBJECT(connection->gobj()),
+    &giomm_multiloopsocketservice_connection_finalized, new std::shared_ptr<Counters>(counters));
+
+  return slot(connection, source_object);
+}
+
+MultiLoopSocketService::MultiLoopSocketService(unsigned int n_loops)
+{
+  if (n_loops == 0)
+    n_loops = std::max(1u, std::thread::hardware_concurrency());
+
+  loops_.reserve(n_loops);
+  for (unsigned int i = 0; i < n_loops; ++i)
+    loops_.emplace_back(std::make_unique<Loop>());
+}
+
+MultiLoopSocketService::~MultiLoopSocketService() noexcept
+{
+  stop();
+}
+
+guint16
+MultiLoopSocketService::add_inet_port(guint16 port)
+{
+  g_return_val_if_fail(!running_, 0);
+
+  const std::size_t n_listeners = has_per_loop_listeners() ? loops_.size() : 1;
+  for (std::size_t i = 0; i < n_listeners; ++i)
+  {
+    auto socket = create_listening_socket(port);
+    if (port == 0)
+    {
+      // All sockets of the group must listen on the port that the
+      // operating system chose for the first one.
+      auto address = std::dynamic_pointer_cast<InetSocketAddress>(socket->get_local_address());
+      if (address)
+        port = address->get_port();
+    }
+    loops_[i]->sockets.emplace_back(std::move(socket));
+  }
+  return port;
+}
+
+void
+MultiLoopSocketService::start(const SlotIncoming& slot)
+{
+  g_return_if_fail(!running_);
+
+  running_ = true;
+  for (auto& loop : loops_)
+  {
+    // Each thread gets its own copy. A sigc::slot must not be shared between threads.
+    loop->slot = slot;
+    loop->thread = std::thread(&Loop::run, loop.get(), std::cref(loops_));
+  }
+}
+
+void
+MultiLoopSocketService::stop()
+{
+  if (!running_)
+    return;
+
+  for (auto& loop : loops_)
+  {
+    // If the loop has not yet started running, a direct call to quit()
+    // would be lost. The invoked slot is executed when the loop runs.
+    auto mainloop = loop->mainloop;
+    loop->context->invoke([mainloop]() -> bool
+      {
+        mainloop->quit();
+        return false;
+      });
+  }
+
+  for (auto& loop : loops_)
+  {
+    loop->thread.join();
+    loop->slot = {};
+  }
+  running_ = false;
+}
+
+bool
+MultiLoopSocketService::is_running() const
+{
+  return running_;
+}
+
+unsigned int
+MultiLoopSocketService::get_n_loops() const
+{
+  return loops_.size();
+}
+
+bool
+MultiLoopSocketService::has_per_loop_listeners()
+{
+#ifdef GIOMM_LOAD_BALANCING_REUSEPORT
+  return true;
+#else
+  return false;
+#endif
+}
+
+Glib::RefPtr<Glib::MainContext>
+MultiLoopSocketService::get_context(unsigned int loop_index) const
+{
+  g_return_val_if_fail(loop_index < loops_.size(), Glib::RefPtr<Glib::MainContext>());
+  return loops_[loop_index]->context;
+}
+
+MultiLoopSocketService::LoopStats
+MultiLoopSocketService::get_loop_stats(unsigned int loop_index) const
+{
+  LoopStats stats;
+  g_return_val_if_fail(loop_index < loops_.size(), stats);
+
+  const auto& counters = *loops_[loop_index]->counters;
+  stats.accepted = counters.accepted;
+  stats.active = counters.active;
+  return stats;
+}
+
+} // namespace Gio
@@ -0,0 +1,152 @@
+#ifndef _GIOMM_MULTILOOPSOCKETSERVICE_H
+#define _GIOMM_MULTILOOPSOCKETSERVICE_H
+
+/* Copyright (C) 2026 The giomm Development Team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <giommconfig.h>
+#include <glibmm/main.h>
+#include <glibmm/object.h>
+#include <glibmm/refptr.h>
+#include <giomm/socketconnection.h>
+#include <sigc++/sigc++.h>
+#include <memory>
+#include <vector>
+
+namespace Gio
+{
+
+/** A socket service that accepts and handles connections in several main loops.
+ *
+ * ThreadedSocketService accepts all connections in one main context and
+ * starts a new thread for each connection. At high connection rates the
+ * thread creation and the single accepting context become bottlenecks.
+ *
+ * %MultiLoopSocketService runs a fixed number of threads, each with its own
+ * MainContext and MainLoop. On Linux (<tt>SO_REUSEPORT</tt>) and FreeBSD
+ * (<tt>SO_REUSEPORT_LB</tt>) every loop has its own listening socket for each
+ * port, and the kernel distributes incoming connections over the sockets.
+ * Elsewhere, including macOS and OpenBSD, whose <tt>SO_REUSEPORT</tt>
+ * does not distribute connections, the first loop accepts all connections and
+ * hands them round-robin to the loops.
+ * The incoming slot is invoked in the thread of the loop that the connection
+ * was assigned to, with that loop's context as the thread-default main
+ * context. Asynchronous operations that the slot starts on the connection
+ * therefore continue in the same loop.
+ *
+ * Unlike a handler of ThreadedSocketService::signal_run(), the incoming slot
+ * must not block. It shall start asynchronous operations and return.
+ *
+ * Example:
+ * @code
+ * Gio::MultiLoopSocketService service; // One loop per CPU core.
+ * const auto port = service.add_inet_port(8080);
+ * service.start([](const Glib::RefPtr<Gio::SocketConnection>& connection,
+ *   const Glib::RefPtr<Glib::Object>&) { start_session(connection); return true; });
+ * @endcode
+ *
+ * The methods of %MultiLoopSocketService shall be called from one thread,
+ * except get_loop_stats(), which may be called from any thread.
+ *
+ * @newin{2,90}
+ * @ingroup NetworkIO
+ */
+class GIOMM_API MultiLoopSocketService
+{
+public:
+  /** Counters of one loop.
+   */
+  struct LoopStats
+  {
+    /// Number of connections that have been handed to the incoming slot.
+    guint64 accepted = 0;
+    /// Number of those connections that still exist.
+    guint64 active = 0;
+  };
+
+  /** For instance,
+   * bool on_incoming(const Glib::RefPtr<Gio::SocketConnection>& connection,
+   *   const Glib::RefPtr<Glib::Object>& source_object);
+   *
+   * The return value has the same meaning as in SocketService::signal_incoming().
+   */
+  using SlotIncoming = sigc::slot<bool(
+    const Glib::RefPtr<SocketConnection>&, const Glib::RefPtr<Glib::Object>&)>;
+
+  /** Creates a service.
+   * @param n_loops The number of main loops and threads.
+   *        If 0, one loop per processor is created.
+   */
+  explicit MultiLoopSocketService(unsigned int n_loops = 0);
+
+  /// Stops the service, if it's running.
+  ~MultiLoopSocketService() noexcept;
+
+  // noncopyable
+  MultiLoopSocketService(const MultiLoopSocketService&) = delete;
+  MultiLoopSocketService& operator=(const MultiLoopSocketService&) = delete;
+
+  /** Listens for TCP connections on a port, on all network interfaces.
+   *
+   * Must be called before start().
+   * An IPv6 socket is used, if available. On most systems it also accepts
+   * IPv4 connections.
+   *
+   * @param port The port number, or 0 to let the operating system choose one.
+   * @return The port number.
+   * @throw Glib::Error
+   */
+  guint16 add_inet_port(guint16 port);
+
+  /** Starts the loops.
+   * @param slot The slot that is called for each incoming connection.
+   */
+  void start(const SlotIncoming& slot);
+
+  /** Stops the loops and waits for their threads to finish.
+   * Connections that are referenced elsewhere are not closed.
+   */
+  void stop();
+
+  bool is_running() const;
+
+  unsigned int get_n_loops() const;
+
+  /** Returns <tt>true</tt> if each loop has its own listening sockets
+   * (<tt>SO_REUSEPORT</tt> on Linux, <tt>SO_REUSEPORT_LB</tt> on FreeBSD),
+   * <tt>false</tt> if the first loop accepts all connections.
+   */
+  static bool has_per_loop_listeners();
+
+  /** Gets the main context of a loop.
+   * @param loop_index 0 <= @a loop_index < get_n_loops().
+   */
+  Glib::RefPtr<Glib::MainContext> get_context(unsigned int loop_index) const;
+
+  /** Gets the counters of a loop.
+   * @param loop_index 0 <= @a loop_index < get_n_loops().
+   */
+  LoopStats get_loop_stats(unsigned int loop_index) const;
+
+private:
+  struct Loop;
+  std::vector<std::unique_ptr<Loop>> loops_;
+  bool running_ = false;
+};
+
+} // namespace Gio
+
+#endif /* _GIOMM_MULTILOOPSOCKETSERVICE_H */
@@ -0,0 +1,377 @@
+/* Copyright (C) 2026 The giomm Development Team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <giomm/settingscache.h>
+#include <gio/gio.h>
+#include <cstring>
+
+namespace
+{
+
+// Returned by the getters that return references, when called with a wrong key.
+const Glib::ustring empty_string;
+const std::vector<Glib::ustring> empty_strings;
+const Glib::VariantBase empty_value;
+
+} // anonymous namespace
+
+namespace Gio
+{
+
+SettingsCache::SettingsCache(const Glib::RefPtr<Settings>& settings)
+: settings_(settings)
+{
+  g_return_if_fail(settings_);
+
+  GSettingsSchema* schema = nullptr;
+  g_object_get(settings_->gobj(), "settings-schema", &schema, nullptr);
+  g_return_if_fail(schema != nullptr);
+
+  char** const key_names = g_settings_schema_list_keys(schema);
+  for (char** key_name = key_names; *key_name; ++key_name)
+  {
+    GSettingsSchemaKey* const schema_key = g_settings_schema_get_key(schema, *key_name);
+    Entry entry;
+
+    // The range tells if the key is an enum or flags key.
+    GVariant* const range = g_settings_schema_key_get_range(schema_key);
+    const char* range_type = nullptr;
+    g_variant_get(range, "(&sv)", &range_type, nullptr);
+    const char* const value_type =
+      g_variant_type_peek_string(g_settings_schema_key_get_value_type(schema_key));
+    const gsize value_type_length =
+      g_variant_type_get_string_length(g_settings_schema_key_get_value_type(schema_key));
+    const std::string type(value_type, value_type_length);
+
+    if (std::strcmp(range_type, "enum") == 0)
+      entry.type = Type::ENUM;
+    else if (std::strcmp(range_type, "flags") == 0)
+      entry.type = Type::FLAGS;
+    else if (type == "b")
+      entry.type = Type::BOOLEAN;
+    else if (type == "i")
+      entry.type = Type::INT32;
+    else if (type == "x")
+      entry.type = Type::INT64;
+    else if (type == "u")
+      entry.type = Type::UINT32;
+    else if (type == "t")
+      entry.type = Type::UINT64;
+    else if (type == "d")
+      entry.type = Type::DOUBLE;
+    else if (type == "s")
+      entry.type = Type::STRING;
+    else if (type == "as")
+      entry.type = Type::STRING_ARRAY;
+
+    g_variant_unref(range);
+    g_settings_schema_key_unref(schema_key);
+
+    keys_.emplace(*key_name, names_.size());
+    names_.emplace_back(*key_name);
+    entries_.emplace_back(std::move(entry));
+  }
+  g_strfreev(key_names);
+  g_settings_schema_unref(schema);
+
+  // Connect before reading the values, so that a change in between is not missed.
+  changed_connection_ = settings_->signal_changed().connect(
+    sigc::mem_fun(*this, &SettingsCache::on_settings_changed));
+
+  refresh();
+}
+
+SettingsCache::~SettingsCache() noexcept
+{
+  changed_connection_.disconnect();
+}
+
+Glib::RefPtr<Settings>
+SettingsCache::get_settings() const
+{
+  return settings_;
+}
+
+const std::vector<Glib::ustring>&
+SettingsCache::get_keys() const
+{
+  return names_;
+}
+
+SettingsCache::Key
+SettingsCache::find_key(const Glib::ustring& key) const
+{
+  const auto iter = keys_.find(key.raw());
+  return iter != keys_.end() ? iter->second : invalid_key;
+}
+
+void
+SettingsCache::refresh()
+{
+  for (Key key = 0; key < entries_.size(); ++key)
+    refresh(key);
+}
+
+void
+SettingsCache::refresh(Key key)
+{
+  g_return_if_fail(key < entries_.size());
+
+  GSettings* const gsettings = settings_->gobj();
+  const char* const name = names_[key].c_str();
+  Entry& entry = entries_[key];
+
+  GVariant* const value = g_settings_get_value(gsettings, name);
+  entry.value = Glib::VariantBase(value); // Takes ownership.
+
+  switch (entry.type)
+  {
+  case Type::BOOLEAN:
+    entry.scalar.boolean = g_variant_get_boolean(value);
+    break;
+  case Type::INT32:
+    entry.scalar.int32 = g_variant_get_int32(value);
+    break;
+  case Type::INT64:
+    entry.scalar.int64 = g_variant_get_int64(value);
+    break;
+  case Type::UINT32:
+    entry.scalar.uint32 = g_variant_get_uint32(value);
+    break;
+  case Type::UINT64:
+    entry.scalar.uint64 = g_variant_get_uint64(value);
+    break;
+  case Type::DOUBLE:
+    entry.scalar.dbl = g_variant_get_double(value);
+    break;
+  case Type::STRING:
+    entry.string = g_variant_get_string(value, nullptr);
+    break;
+  case Type::STRING_ARRAY:
+  {
+    gsize length = 0;
+    const char** const strv = g_variant_get_strv(value, &length);
+    entry.strings.assign(strv, strv + length);
+    g_free(strv);
+    break;
+  }
+  case Type::ENUM:
+    entry.string = g_variant_get_string(value, nullptr);
+    entry.scalar.int32 = g_settings_get_enum(gsettings, name);
+    break;
+  case Type::FLAGS:
+    entry.scalar.uint32 = g_settings_get_flags(gsettings, name);
+    break;
+  case Type::OTHER:
+    break;
+  }
+}
+
+const SettingsCache::Entry*
+SettingsCache::get_entry(Key key, Type type) const
+{
+  g_return_val_if_fail(key < entries_.size(), nullptr);
+
+  const Entry& entry = entries_[key];
+  g_return_val_if_fail(entry.type == type || type == Type::OTHER ||
+                       (type == Type::STRING && entry.type == Type::ENUM), nullptr);
+  return &entry;
+}
+
+const SettingsCache::Entry*
+SettingsCache::get_entry(const Glib::ustring& key, Type type) const
+{
+  const Key index = find_key(key);
+  if (index == invalid_key)
+  {
+    g_critical("Gio::SettingsCache: The schema has no key \"%s\".", key.c_str());
+    return nullptr;
+  }
+  return get_entry(index, type);
+}
+
+bool
+SettingsCache::get_boolean(Key key) const
+{
+  const Entry* const entry = get_entry(key, Type::BOOLEAN);
+  return entry ? entry->scalar.boolean : false;
+}
+
+int
+SettingsCache::get_int(Key key) const
+{
+  const Entry* const entry = get_entry(key, Type::INT32);
+  return entry ? entry->scalar.int32 : 0;
+}
+
+gint64
+SettingsCache::get_int64(Key key) const
+{
+  const Entry* const entry = get_entry(key, Type::INT64);
+  return entry ? entry->scalar.int64 : 0;
+}
+
+guint
+SettingsCache::get_uint(Key key) const
+{
+  const Entry* const entry = get_entry(key, Type::UINT32);
+  return entry ? entry->scalar.uint32 : 0;
+}
+
+guint64
+SettingsCache::get_uint64(Key key) const
+{
+  const Entry* const entry = get_entry(key, Type::UINT64);
+  return entry ? entry->scalar.uint64 : 0;
+}
+
+double
+SettingsCache::get_double(Key key) const
+{
+  const Entry* const entry = get_entry(key, Type::DOUBLE);
+  return entry ? entry->scalar.dbl : 0.0;
+}
+
+const Glib::ustring&
+SettingsCache::get_string(Key key) const
+{
+  const Entry* const entry = get_entry(key, Type::STRING);
+  return entry ? entry->string : empty_string;
+}
+
+const std::vector<Glib::ustring>&
+SettingsCache::get_string_array(Key key) const
+{
+  const Entry* const entry = get_entry(key, Type::STRING_ARRAY);
+  return entry ? entry->strings : empty_strings;
+}
+
+int
+SettingsCache::get_enum(Key key) const
+{
+  const Entry* const entry = get_entry(key, Type::ENUM);
+  return entry ? entry->scalar.int32 : 0;
+}
+
+guint
+SettingsCache::get_flags(Key key) const
+{
+  const Entry* const entry = get_entry(key, Type::FLAGS);
+  return entry ? entry->scalar.uint32 : 0;
+}
+
+const Glib::VariantBase&
+SettingsCache::get_value(Key key) const
+{
+  const Entry* const entry = get_entry(key, Type::OTHER);
+  return entry ? entry->value : empty_value;
+}
+
+bool
+SettingsCache::get_boolean(const Glib::ustring& key) const
+{
+  const Entry* const entry = get_entry(key, Type::BOOLEAN);
+  return entry ? entry->scalar.boolean : false;
+}
+
+int
+SettingsCache::get_int(const Glib::ustring& key) const
+{
+  const Entry* const entry = get_entry(key, Type::INT32);
+  return entry ? entry->scalar.int32 : 0;
+}
+
+gint64
+SettingsCache::get_int64(const Glib::ustring& key) const
+{
+  const Entry* const entry = get_entry(key, Type::INT64);
+  return entry ? entry->scalar.int64 : 0;
+}
+
+guint
+SettingsCache::get_uint(const Glib::ustring& key) const
+{
+  const Entry* const entry = get_entry(key, Type::UINT32);
+  return entry ? entry->scalar.uint32 : 0;
+}
+
+guint64
+SettingsCache::get_uint64(const Glib::ustring& key) const
+{
+  const Entry* const entry = get_entry(key, Type::UINT64);
+  return entry ? entry->scalar.uint64 : 0;
+}
+
+double
+SettingsCache::get_double(const Glib::ustring& key) const
+{
+  const Entry* const entry = get_entry(key, Type::DOUBLE);
+  return entry ? entry->scalar.dbl : 0.0;
+}
+
+const Glib::ustring&
+SettingsCache::get_string(const Glib::ustring& key) const
+{
+  const Entry* const entry = get_entry(key, Type::STRING);
+  return entry ? entry->string : empty_string;
+}
+
+const std::vector<Glib::ustring>&
+SettingsCache::get_string_array(const Glib::ustring& key) const
+{
+  const Entry* const entry = get_entry(key, Type::STRING_ARRAY);
+  return entry ? entry->strings : empty_strings;
+}
+
+int
+SettingsCache::get_enum(const Glib::ustring& key) const
+{
+  const Entry* const entry = get_entry(key, Type::ENUM);
+  return entry ? entry->scalar.int32 : 0;
+}
+
+guint
+SettingsCache::get_flags(const Glib::ustring& key) const
+{
+  const Entry* const entry = get_entry(key, Type::FLAGS);
+  return entry ? entry->scalar.uint32 : 0;
+}
+
+const Glib::VariantBase&
+SettingsCache::get_value(const Glib::ustring& key) const
+{
+  const Entry* const entry = get_entry(key, Type::OTHER);
+  return entry ? entry->value : empty_value;
+}
+
+sigc::signal<void(SettingsCache::Key)>&
+SettingsCache::signal_changed()
+{
+  return signal_changed_;
+}
+
+void
+SettingsCache::on_settings_changed(const Glib::ustring& key)
+{
+  const Key index = find_key(key);
+  if (index == invalid_key)
+    return;
+
+  refresh(index);
+  signal_changed_.emit(index);
+}
+
+} // namespace Gio
@@ -0,0 +1,190 @@
+#ifndef _GIOMM_SETTINGSCACHE_H
+#define _GIOMM_SETTINGSCACHE_H
+
+/* Copyright (C) 2026 The giomm Development Team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <giommconfig.h>
+#include <glibmm/refptr.h>
+#include <glibmm/ustring.h>
+#include <glibmm/variant.h>
+#include <giomm/settings.h>
+#include <sigc++/sigc++.h>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Gio
+{
+
+/** A snapshot of the values of all keys of a Settings object.
+ *
+ * Each Settings::get_int(), Settings::get_string() or Settings::get_value()
+ * call asks the settings backend for the value and creates a new GVariant,
+ * and get_string() also a new Glib::ustring. %SettingsCache reads all keys
+ * of the schema once, decodes them according to their types, and stores the
+ * values. Its getters return the stored values without calling GSettings,
+ * without allocating memory and without locking. When Settings::signal_changed()
+ * is emitted, only the changed key is read again.
+ *
+ * Look up a key once with find_key(), and read it in hot code with the
+ * getters that take a Key. The getters that take a key name look up the name
+ * in a hash table first.
+ *
+ * @code
+ * Gio::SettingsCache cache(Gio::Settings::create("org.example.app"));
+ * const auto max_items = cache.find_key("max-items");
+ * for (const auto& item : items)
+ *   if (count++ < cache.get_int(max_items))
+ *     process(item);
+ * @endcode
+ *
+ * The values are updated in the thread that emits the Settings object's
+ * signals, i.e. in the thread-default main context of the thread that
+ * created the Settings object. Use a %SettingsCache only in that thread.
+ *
+ * @newin{2,90}
+ */
+class GIOMM_API SettingsCache
+{
+public:
+  /// An index of a key. Valid for the %SettingsCache that returned it.
+  using Key = guint;
+
+  /// The Key returned by find_key() for an unknown key name.
+  static constexpr Key invalid_key = G_MAXUINT;
+
+  /** Reads all keys of a Settings object's schema.
+   * @param settings The Settings to read. Its schema determines the keys.
+   */
+  explicit SettingsCache(const Glib::RefPtr<Settings>& settings);
+
+  /** Stops following the changes of the Settings object.
+   */
+  ~SettingsCache() noexcept;
+
+  // noncopyable
+  SettingsCache(const SettingsCache&) = delete;
+  SettingsCache& operator=(const SettingsCache&) = delete;
+
+  Glib::RefPtr<Settings> get_settings() const;
+
+  /** Gets the names of all keys, in the order of their Key values.
+   */
+  const std::vector<Glib::ustring>& get_keys() const;
+
+  /** Looks up a key.
+   * @param key The name of a key in the schema.
+   * @return The Key, or #invalid_key if there's no key with that name.
+   */
+  Key find_key(const Glib::ustring& key) const;
+
+  /** Reads all keys again.
+   * This is not necessary as long as Settings::signal_changed() is emitted
+   * for all changes.
+   */
+  void refresh();
+
+  /** Reads one key again.
+   */
+  void refresh(Key key);
+
+  // Getters. They must be called for keys of the matching type, as for the
+  // getters of Settings. get_string() can also be used for enum keys.
+
+  bool get_boolean(Key key) const;
+  int get_int(Key key) const;
+  gint64 get_int64(Key key) const;
+  guint get_uint(Key key) const;
+  guint64 get_uint64(Key key) const;
+  double get_double(Key key) const;
+  const Glib::ustring& get_string(Key key) const;
+  const std::vector<Glib::ustring>& get_string_array(Key key) const;
+  int get_enum(Key key) const;
+  guint get_flags(Key key) const;
+
+  /** Gets the value of a key of any type.
+   */
+  const Glib::VariantBase& get_value(Key key) const;
+
+  bool get_boolean(const Glib::ustring& key) const;
+  int get_int(const Glib::ustring& key) const;
+  gint64 get_int64(const Glib::ustring& key) const;
+  guint get_uint(const Glib::ustring& key) const;
+  guint64 get_uint64(const Glib::ustring& key) const;
+  double get_double(const Glib::ustring& key) const;
+  const Glib::ustring& get_string(const Glib::ustring& key) const;
+  const std::vector<Glib::ustring>& get_string_array(const Glib::ustring& key) const;
+  int get_enum(const Glib::ustring& key) const;
+  guint get_flags(const Glib::ustring& key) const;
+  const Glib::VariantBase& get_value(const Glib::ustring& key) const;
+
+  /** Emitted after a key has been read again because it has changed.
+   *
+   * @par Slot Prototype:
+   * <tt>void on_my_%changed(Key key)</tt>
+   */
+  sigc::signal<void(Key)>& signal_changed();
+
+private:
+  enum class Type
+  {
+    BOOLEAN,
+    INT32,
+    INT64,
+    UINT32,
+    UINT64,
+    DOUBLE,
+    STRING,
+    STRING_ARRAY,
+    ENUM,
+    FLAGS,
+    OTHER
+  };
+
+  struct Entry
+  {
+    Type type = Type::OTHER;
+    union
+    {
+      bool boolean;
+      gint32 int32;
+      gint64 int64;
+      guint32 uint32;
+      guint64 uint64;
+      double dbl;
+    } scalar{};
+    // Also the nick of an enum key.
+    Glib::ustring string;
+    std::vector<Glib::ustring> strings;
+    Glib::VariantBase value;
+  };
+
+  const Entry* get_entry(Key key, Type type) const;
+  const Entry* get_entry(const Glib::ustring& key, Type type) const;
+  void on_settings_changed(const Glib::ustring& key);
+
+  Glib::RefPtr<Settings> settings_;
+  std::vector<Glib::ustring> names_;
+  std::vector<Entry> entries_;
+  std::unordered_map<std::string, Key> keys_;
+  sigc::connection changed_connection_;
+  sigc::signal<void(Key)> signal_changed_;
+};
+
+} // namespace Gio
+
+#endif /* _GIOMM_SETTINGSCACHE_H */
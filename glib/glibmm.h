@@ -121,7 +121,9 @@
 #include <glibmm/iochannel.h>
 #include <glibmm/init.h>
 #include <glibmm/keyfile.h>
+#include <glibmm/latencyhistogram.h>
 #include <glibmm/main.h>
+#include <glibmm/mainloopgroup.h>
 #include <glibmm/markup.h>
 #include <glibmm/miscutils.h>
 #include <glibmm/module.h>
@@ -141,8 +143,12 @@
 #include <glibmm/signalproxy_connectionnode.h>
 #include <glibmm/signalproxy.h>
 #include <glibmm/spawn.h>
+#include <glibmm/stopwatch.h>
 #include <glibmm/stringutils.h>
+#include <glibmm/strvview.h>
+#include <glibmm/threadpool.h>
 #include <glibmm/timer.h>
+#include <glibmm/timestamp.h>
 #include <glibmm/timezone.h>
 #include <glibmm/uriutils.h>
 #include <glibmm/ustring.h>
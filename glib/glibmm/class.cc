@@ -20,9 +20,24 @@
 #include <glibmm/utility.h>
 #include <glibmm/interface.h>
 #include <glibmm/private/interface_p.h>
+#include <string>
 
 namespace
 {
+// Each construction of an object of a custom type calls clone_custom_type().
+// Building the full type name and looking it up takes a global lock, so the
+// custom types that were found most recently in this thread are remembered.
+struct CustomTypeCacheEntry
+{
+  const Glib::Class* glibmm_class = nullptr;
+  std::string custom_type_name;
+  GType custom_type = 0;
+};
+
+constexpr unsigned int custom_type_cache_size = 4;
+thread_local CustomTypeCacheEntry custom_type_cache[custom_type_cache_size];
+thread_local unsigned int custom_type_cache_next = 0;
+
 // C++ linkage
 using BaseFinalizeFuncType = void (*)(void*);
 using ClassInitFuncType = void (*)(void*, void*);
@@ -121,6 +136,10 @@ Class::clone_custom_type(
   const char* custom_type_name, const interface_classes_type* interface_classes,
   const class_init_funcs_type* class_init_funcs, GInstanceInitFunc instance_init_func) const
 {
+  for (const auto& entry : custom_type_cache)
+    if (entry.glibmm_class == this && entry.custom_type_name == custom_type_name)
+      return entry.custom_type;
+
   std::string full_name("gtkmm__CustomObject_");
   Glib::append_canonical_typename(full_name, custom_type_name);
 
@@ -189,6 +208,12 @@ Class::clone_custom_type(
     }
   }
 
+  // Static types are never unregistered.
+  auto& entry = custom_type_cache[custom_type_cache_next++ % custom_type_cache_size];
+  entry.glibmm_class = this;
+  entry.custom_type_name = custom_type_name;
+  entry.custom_type = custom_type;
+
   return custom_type;
 }
 
@@ -0,0 +1,180 @@
+/* Copyright (C) 2026 The glibmm Development Team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <glibmm/latencyhistogram.h>
+#include <glibmm/main.h>
+#include <glib.h>
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <mutex>
+
+namespace
+{
+
+struct Registry
+{
+  std::mutex mutex;
+  // std::map keeps the histograms sorted by name.
+  std::map<std::string, std::unique_ptr<Glib::LatencyHistogram>> histograms;
+};
+
+Registry&
+get_registry()
+{
+  // Never destroyed. Registered histograms may be used by static objects
+  // that are destroyed late.
+  static Registry* const registry = new Registry;
+  return *registry;
+}
+
+std::string
+format_usec(gint64 nanoseconds)
+{
+  char buffer[G_ASCII_DTOSTR_BUF_SIZE];
+  g_ascii_formatd(buffer, sizeof buffer, "%.3f", nanoseconds * 1.0e-3);
+  return buffer;
+}
+
+} // anonymous namespace
+
+namespace Glib
+{
+
+gint64
+LatencyHistogram::Snapshot::get_percentile_ns(double percent) const
+{
+  if (count == 0)
+    return 0;
+
+  const double rank = percent / 100.0 * count;
+  guint64 n = 0;
+  for (unsigned int i = 0; i < n_buckets; ++i)
+  {
+    n += buckets[i];
+    if (n > 0 && n >= rank)
+    {
+      if (i == 0)
+        return std::min<gint64>(0, max_ns);
+      const gint64 upper_limit =
+        (i >= 63) ? G_MAXINT64 : static_cast<gint64>((G_GUINT64_CONSTANT(1) << i) - 1);
+      return std::min(upper_limit, max_ns);
+    }
+  }
+  return max_ns;
+}
+
+LatencyHistogram::LatencyHistogram(const std::string& name)
+: name_(name)
+{
+}
+
+LatencyHistogram::Snapshot
+LatencyHistogram::get_snapshot() const
+{
+  // The counters are read one by one, so while other threads call record(),
+  // the snapshot is only approximately consistent.
+  Snapshot snapshot;
+  snapshot.count = count_.load(std::memory_order_relaxed);
+  snapshot.total_ns = total_ns_.load(std::memory_order_relaxed);
+  for (unsigned int i = 0; i < n_buckets; ++i)
+    snapshot.buckets[i] = buckets_[i].load(std::memory_order_relaxed);
+  if (snapshot.count > 0)
+  {
+    snapshot.min_ns = min_ns_.load(std::memory_order_relaxed);
+    snapshot.max_ns = max_ns_.load(std::memory_order_relaxed);
+  }
+  return snapshot;
+}
+
+void
+LatencyHistogram::reset() noexcept
+{
+  count_.store(0, std::memory_order_relaxed);
+  total_ns_.store(0, std::memory_order_relaxed);
+  min_ns_.store(G_MAXINT64, std::memory_order_relaxed);
+  max_ns_.store(G_MININT64, std::memory_order_relaxed);
+  for (auto& bucket : buckets_)
+    bucket.store(0, std::memory_order_relaxed);
+}
+
+std::string
+LatencyHistogram::to_string() const
+{
+  const Snapshot snapshot = get_snapshot();
+  return name_ + ": count=" + std::to_string(snapshot.count) +
+         " mean=" + format_usec(static_cast<gint64>(snapshot.get_mean_ns())) +
+         "us min=" + format_usec(snapshot.min_ns) +
+         "us p50=" + format_usec(snapshot.get_percentile_ns(50.0)) +
+         "us p99=" + format_usec(snapshot.get_percentile_ns(99.0)) +
+         "us max=" + format_usec(snapshot.max_ns) + "us";
+}
+
+// static
+LatencyHistogram&
+LatencyHistogram::get(const std::string& name)
+{
+  auto& registry = get_registry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  auto& histogram = registry.histograms[name];
+  if (!histogram)
+    histogram = std::make_unique<LatencyHistogram>(name);
+  return *histogram;
+}
+
+// static
+std::string
+LatencyHistogram::dump_all()
+{
+  auto& registry = get_registry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  std::string result;
+  for (const auto& histogram : registry.histograms)
+  {
+    result += histogram.second->to_string();
+    result += '\n';
+  }
+  return result;
+}
+
+// static
+void
+LatencyHistogram::reset_all()
+{
+  auto& registry = get_registry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  for (auto& histogram : registry.histograms)
+    histogram.second->reset();
+}
+
+// static
+sigc::connection
+LatencyHistogram::dump_periodically(unsigned int interval_seconds,
+  const sigc::slot<void(const std::string&)>& slot, const Glib::RefPtr<MainContext>& context)
+{
+  const auto main_context = context ? context : MainContext::get_default();
+  return main_context->signal_timeout().connect_seconds([slot]() -> bool
+    {
+      const std::string dump = dump_all();
+      if (slot)
+        slot(dump);
+      else if (!dump.empty())
+        g_message("Latencies:\n%s", dump.c_str());
+      return true;
+    }, interval_seconds);
+}
+
+} // namespace Glib
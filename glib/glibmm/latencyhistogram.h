@@ -0,0 +1,214 @@
+#ifndef _GLIBMM_LATENCYHISTOGRAM_H
+#define _GLIBMM_LATENCYHISTOGRAM_H
+
+/* Copyright (C) 2026 The glibmm Development Team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <glibmmconfig.h>
+#include <glibmm/refptr.h>
+#include <glibmm/stopwatch.h>
+#include <sigc++/sigc++.h>
+#include <array>
+#include <atomic>
+#include <string>
+
+namespace Glib
+{
+
+class GLIBMM_API MainContext;
+
+/** A thread-safe histogram of durations, e.g. latencies.
+ *
+ * The durations are counted in buckets of powers of two nanoseconds.
+ * Bucket number i > 0 counts durations in the range
+ * [2<sup>i-1</sup>, 2<sup>i</sup>) ns, bucket 0 counts durations <= 0.
+ * record() is inline and lock-free.
+ *
+ * Histograms created with get() are kept in a registry, where they are found
+ * by name. dump_all() and dump_periodically() report all registered histograms.
+ *
+ * @code
+ * void handle_request()
+ * {
+ *   GLIBMM_SCOPE_TIMER("handle_request");
+ *   ...
+ * }
+ *
+ * // In main():
+ * Glib::LatencyHistogram::dump_periodically(10);
+ * @endcode
+ *
+ * @newin{2,90}
+ */
+class GLIBMM_API LatencyHistogram
+{
+public:
+  /// The number of buckets.
+  static constexpr unsigned int n_buckets = 64;
+
+  /** The contents of a histogram at one point in time.
+   */
+  struct Snapshot
+  {
+    guint64 count = 0;
+    gint64 total_ns = 0;
+    gint64 min_ns = 0;
+    gint64 max_ns = 0;
+    std::array<guint64, n_buckets> buckets{};
+
+    /// Mean duration.
+    double get_mean_ns() const { return count ? static_cast<double>(total_ns) / count : 0.0; }
+
+    /** Estimates a percentile.
+     * @param percent 0 <= @a percent <= 100.
+     * @return The upper limit of the bucket that contains the percentile,
+     *         but not more than max_ns.
+     */
+    gint64 get_percentile_ns(double percent) const;
+  };
+
+  /** Creates a histogram that is not registered.
+   * Use get() to create a registered histogram.
+   */
+  explicit LatencyHistogram(const std::string& name = {});
+
+  // noncopyable
+  LatencyHistogram(const LatencyHistogram&) = delete;
+  LatencyHistogram& operator=(const LatencyHistogram&) = delete;
+
+  const std::string& get_name() const { return name_; }
+
+  /// Adds a duration in nanoseconds.
+  inline void record(gint64 duration_ns) noexcept;
+
+  /// Gets the current contents.
+  Snapshot get_snapshot() const;
+
+  /// Removes all recorded durations.
+  void reset() noexcept;
+
+  /// Gets the contents as one line of text, with durations in microseconds.
+  std::string to_string() const;
+
+  /** Gets a registered histogram, and creates it if it does not exist.
+   *
+   * Registered histograms live until the program ends. The returned reference
+   * can be stored, e.g. in a static variable, to avoid the look-up.
+   */
+  static LatencyHistogram& get(const std::string& name);
+
+  /// Gets to_string() of all registered histograms, one per line, sorted by name.
+  static std::string dump_all();
+
+  /// Calls reset() on all registered histograms.
+  static void reset_all();
+
+  /** Writes dump_all() at regular intervals from a main loop.
+   *
+   * @param interval_seconds The interval between dumps.
+   * @param slot Receives the dump. If empty, the dump is logged with g_message().
+   * @param context The main context. If empty, the global default main context.
+   * @return The connection of the timeout. Disconnect it to stop dumping.
+   */
+  static sigc::connection dump_periodically(unsigned int interval_seconds,
+    const sigc::slot<void(const std::string&)>& slot = {},
+    const Glib::RefPtr<MainContext>& context = {});
+
+private:
+  static unsigned int get_bucket(gint64 duration_ns) noexcept;
+
+  std::string name_;
+  std::atomic<guint64> count_{ 0 };
+  std::atomic<gint64> total_ns_{ 0 };
+  std::atomic<gint64> min_ns_{ G_MAXINT64 };
+  std::atomic<gint64> max_ns_{ G_MININT64 };
+  std::array<std::atomic<guint64>, n_buckets> buckets_{};
+};
+
+/** Measures the time until the end of a scope, and adds it to a LatencyHistogram.
+ *
+ * GLIBMM_SCOPE_TIMER(name) creates a %ScopeTimer that feeds the registered
+ * histogram @a name. The histogram is looked up only once per call site.
+ *
+ * @newin{2,90}
+ */
+class ScopeTimer
+{
+public:
+  explicit ScopeTimer(LatencyHistogram& histogram) noexcept : histogram_(histogram) {}
+  ~ScopeTimer() noexcept { histogram_.record(stopwatch_.elapsed_ns()); }
+
+  // noncopyable
+  ScopeTimer(const ScopeTimer&) = delete;
+  ScopeTimer& operator=(const ScopeTimer&) = delete;
+
+private:
+  LatencyHistogram& histogram_;
+  StopWatch stopwatch_;
+};
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+#define GLIBMM_SCOPE_TIMER_CONCAT2_(a, b) a##b
+#define GLIBMM_SCOPE_TIMER_CONCAT_(a, b) GLIBMM_SCOPE_TIMER_CONCAT2_(a, b)
+#endif
+
+/** Measures the time until the end of the current scope, and adds it to
+ * the registered LatencyHistogram @a name.
+ * @newin{2,90}
+ */
+#define GLIBMM_SCOPE_TIMER(name)                                                            \
+  static ::Glib::LatencyHistogram& GLIBMM_SCOPE_TIMER_CONCAT_(glibmm_scope_histogram_,      \
+    __LINE__) = ::Glib::LatencyHistogram::get(name);                                        \
+  ::Glib::ScopeTimer GLIBMM_SCOPE_TIMER_CONCAT_(glibmm_scope_timer_, __LINE__)(             \
+    GLIBMM_SCOPE_TIMER_CONCAT_(glibmm_scope_histogram_, __LINE__))
+
+inline unsigned int
+LatencyHistogram::get_bucket(gint64 duration_ns) noexcept
+{
+  if (duration_ns <= 0)
+    return 0;
+#if defined(__GNUC__) || defined(__clang__)
+  return 64 - __builtin_clzll(static_cast<unsigned long long>(duration_ns));
+#else
+  unsigned int bucket = 0;
+  for (guint64 d = duration_ns; d != 0; d >>= 1)
+    ++bucket;
+  return bucket;
+#endif
+}
+
+inline void
+LatencyHistogram::record(gint64 duration_ns) noexcept
+{
+  count_.fetch_add(1, std::memory_order_relaxed);
+  total_ns_.fetch_add(duration_ns, std::memory_order_relaxed);
+  buckets_[get_bucket(duration_ns)].fetch_add(1, std::memory_order_relaxed);
+
+  gint64 old_min = min_ns_.load(std::memory_order_relaxed);
+  while (duration_ns < old_min &&
+         !min_ns_.compare_exchange_weak(old_min, duration_ns, std::memory_order_relaxed))
+  {
+  }
+  gint64 old_max = max_ns_.load(std::memory_order_relaxed);
+  while (duration_ns > old_max &&
+         !max_ns_.compare_exchange_weak(old_max, duration_ns, std::memory_order_relaxed))
+  {
+  }
+}
+
+} // namespace Glib
+
+#endif /* _GLIBMM_LATENCYHISTOGRAM_H */
@@ -19,7 +19,13 @@
 #include <glibmm/wrap.h>
 #include <glibmm/iochannel.h>
 #include <glibmm/utility.h>
+#include <glibmm/stopwatch.h>
 #include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <mutex>
 
 namespace
 {
@@ -170,6 +176,285 @@ glibmm_source_get_callback_data(GSource* source)
   return static_cast<SourceCallbackData*>(user_data);
 }
 
+/**** MainContext instrumentation *****************************************/
+
+/* The instrumentation of a GMainContext. The histograms are kept per source
+ * name, so that the statistics of a source that is created again and again,
+ * such as the idle source of MainContext::invoke(), are added up.
+ */
+struct Instrumentation
+{
+  struct SourceHistograms
+  {
+    // The key of this entry in sources.
+    const char* name = nullptr;
+    Glib::LatencyHistogram dispatch;
+    Glib::LatencyHistogram lateness;
+  };
+
+  explicit Instrumentation(GMainContext* context_) : context(context_) {}
+
+  SourceHistograms& get_source_histograms(const char* name);
+
+  GMainContext* const context;
+  // The ID of the InstrumentationSource, which measures the iterations.
+  unsigned int source_id = 0;
+  Glib::LatencyHistogram iterations;
+
+  std::mutex mutex;
+  // Never erased, while the Instrumentation exists. DispatchCache keeps pointers.
+  std::map<std::string, std::unique_ptr<SourceHistograms>, std::less<>> sources;
+};
+
+Instrumentation::SourceHistograms&
+Instrumentation::get_source_histograms(const char* name)
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  auto iter = sources.find(name);
+  if (iter == sources.end())
+  {
+    iter = sources.emplace(name, std::make_unique<SourceHistograms>()).first;
+    iter->second->name = iter->first.c_str();
+  }
+  return *iter->second;
+}
+
+std::mutex instrumentation_mutex;
+std::map<GMainContext*, std::shared_ptr<Instrumentation>> instrumentations;
+// The number of entries in instrumentations. Checked without locking the mutex.
+std::atomic<std::size_t> n_instrumentations{ 0 };
+// Incremented whenever instrumentations changes. Invalidates the DispatchCaches.
+std::atomic<std::size_t> instrumentations_generation{ 0 };
+
+std::shared_ptr<Instrumentation>
+find_instrumentation(GMainContext* context)
+{
+  if (n_instrumentations.load(std::memory_order_relaxed) == 0)
+    return nullptr;
+
+  std::lock_guard<std::mutex> lock(instrumentation_mutex);
+  const auto iter = instrumentations.find(context ? context : g_main_context_default());
+  return (iter != instrumentations.end()) ? iter->second : nullptr;
+}
+
+/* A source that is never dispatched. It is checked after each poll and
+ * prepared at the start of each iteration, which gives the time spent
+ * between the end of the poll and the next iteration.
+ */
+struct InstrumentationSource
+{
+  GSource base;
+  std::shared_ptr<Instrumentation>* instrumentation;
+  gint64 check_time_ns;
+};
+
+extern "C"
+{
+static gboolean
+glibmm_instrumentation_source_prepare(GSource* source, int* timeout)
+{
+  auto self = reinterpret_cast<InstrumentationSource*>(source);
+  if (self->check_time_ns >= 0)
+    (*self->instrumentation)->iterations.record(Glib::StopWatch::now_ns() - self->check_time_ns);
+  self->check_time_ns = -1;
+  *timeout = -1;
+  return false;
+}
+
+static gboolean
+glibmm_instrumentation_source_check(GSource* source)
+{
+  reinterpret_cast<InstrumentationSource*>(source)->check_time_ns = Glib::StopWatch::now_ns();
+  return false;
+}
+
+static gboolean
+glibmm_instrumentation_source_dispatch(GSource*, GSourceFunc, void*)
+{
+  return G_SOURCE_CONTINUE;
+}
+
+static void
+glibmm_instrumentation_source_finalize(GSource* source)
+{
+  auto self = reinterpret_cast<InstrumentationSource*>(source);
+  {
+    // Unless enable_instrumentation(false) has already removed the
+    // instrumentation, the context is being destroyed.
+    std::lock_guard<std::mutex> lock(instrumentation_mutex);
+    const auto iter = instrumentations.find((*self->instrumentation)->context);
+    if (iter != instrumentations.end() && iter->second == *self->instrumentation)
+    {
+      instrumentations.erase(iter);
+      n_instrumentations = instrumentations.size();
+      ++instrumentations_generation;
+    }
+  }
+  delete self->instrumentation;
+}
+} // extern "C"
+
+GSourceFuncs instrumentation_source_funcs = {
+  &glibmm_instrumentation_source_prepare,
+  &glibmm_instrumentation_source_check,
+  &glibmm_instrumentation_source_dispatch,
+  &glibmm_instrumentation_source_finalize,
+  nullptr, // closure_callback
+  nullptr, // closure_marshal
+};
+
+/* A per-thread cache of the histograms of recently dispatched sources, indexed
+ * by the context and the address of the source's name, which is usually a
+ * static string. A dispatch finds its histograms here without locking a mutex
+ * or allocating memory. Contexts without instrumentation are cached too.
+ */
+class DispatchCache
+{
+public:
+  // Returns nullptr if the context is not instrumented.
+  Instrumentation::SourceHistograms* find(GMainContext* context, const char* name,
+    std::shared_ptr<Instrumentation>& instrumentation);
+
+private:
+  struct Entry
+  {
+    GMainContext* context = nullptr;
+    const char* name = nullptr;
+    // Keeps the histograms alive. nullptr if the context is not instrumented.
+    std::shared_ptr<Instrumentation> instrumentation;
+    Instrumentation::SourceHistograms* histograms = nullptr;
+  };
+
+  static constexpr std::size_t size = 32;
+  std::size_t generation_ = 0;
+  Entry entries_[size];
+};
+
+Instrumentation::SourceHistograms*
+DispatchCache::find(GMainContext* context, const char* name,
+  std::shared_ptr<Instrumentation>& instrumentation)
+{
+  const std::size_t generation = instrumentations_generation.load(std::memory_order_acquire);
+  if (generation != generation_)
+  {
+    for (auto& entry : entries_)
+      entry = Entry();
+    generation_ = generation;
+  }
+
+  Entry& entry = entries_[(reinterpret_cast<std::uintptr_t>(name) / 8 ^
+                            reinterpret_cast<std::uintptr_t>(context) / 16) % size];
+
+  // A name at the same address may be a different string,
+  // if it's not a static string.
+  if (entry.context != context || entry.name != name ||
+      (entry.histograms && std::strcmp(entry.histograms->name, name) != 0))
+  {
+    auto found = find_instrumentation(context);
+    entry.histograms = found ? &found->get_source_histograms(name) : nullptr;
+    entry.instrumentation = std::move(found);
+    entry.context = context;
+    entry.name = name;
+  }
+
+  instrumentation = entry.instrumentation;
+  return entry.histograms;
+}
+
+thread_local DispatchCache dispatch_cache;
+
+/* Records the dispatch of a source, if its context is instrumented.
+ * Create it on the stack at the start of a dispatch.
+ */
+class DispatchRecorder
+{
+public:
+  // If source is nullptr, the source being dispatched is recorded.
+  inline DispatchRecorder(GSource* source, const char* default_name);
+  inline ~DispatchRecorder() noexcept;
+
+  // noncopyable
+  DispatchRecorder(const DispatchRecorder&) = delete;
+  DispatchRecorder& operator=(const DispatchRecorder&) = delete;
+
+private:
+  void start(GSource* source, const char* default_name);
+
+  std::shared_ptr<Instrumentation> instrumentation_;
+  Instrumentation::SourceHistograms* histograms_ = nullptr;
+  gint64 start_time_ns_ = 0;
+};
+
+inline DispatchRecorder::DispatchRecorder(GSource* source, const char* default_name)
+{
+  if (n_instrumentations.load(std::memory_order_relaxed) != 0)
+    start(source, default_name);
+}
+
+inline DispatchRecorder::~DispatchRecorder() noexcept
+{
+  if (histograms_)
+    histograms_->dispatch.record(Glib::StopWatch::now_ns() - start_time_ns_);
+}
+
+void
+DispatchRecorder::start(GSource* source, const char* default_name)
+{
+  if (!source)
+    source = g_main_current_source();
+  if (!source)
+    return; // E.g. MainContext::invoke() in the thread that owns the context.
+
+  const char* name = g_source_get_name(source);
+  histograms_ =
+    dispatch_cache.find(g_source_get_context(source), name ? name : default_name, instrumentation_);
+  if (!histograms_)
+    return;
+
+  const gint64 ready_time = g_source_get_ready_time(source);
+  if (ready_time >= 0)
+    histograms_->lateness.record((g_get_monotonic_time() - ready_time) * 1000);
+
+  start_time_ns_ = Glib::StopWatch::now_ns();
+}
+
+void
+append_json_string(std::string& json, const std::string& str)
+{
+  json += '"';
+  for (const char c : str)
+  {
+    if (c == '"' || c == '\\')
+    {
+      json += '\\';
+      json += c;
+    }
+    else if (static_cast<unsigned char>(c) < 0x20)
+    {
+      char escaped[8];
+      g_snprintf(escaped, sizeof escaped, "\\u%04x", static_cast<unsigned int>(c));
+      json += escaped;
+    }
+    else
+      json += c;
+  }
+  json += '"';
+}
+
+void
+append_json_snapshot(std::string& json, const Glib::LatencyHistogram::Snapshot& snapshot)
+{
+  char buffer[256];
+  g_snprintf(buffer, sizeof buffer,
+    "{\"count\": %" G_GUINT64_FORMAT ", \"total_usec\": %" G_GINT64_FORMAT
+    ", \"mean_usec\": %" G_GINT64_FORMAT ", \"p99_usec\": %" G_GINT64_FORMAT
+    ", \"max_usec\": %" G_GINT64_FORMAT "}",
+    snapshot.count, snapshot.total_ns / 1000,
+    static_cast<gint64>(snapshot.get_mean_ns()) / 1000,
+    snapshot.get_percentile_ns(99.0) / 1000, snapshot.max_ns / 1000);
+  json += buffer;
+}
+
 // The function pointers, glibmm_source_*_vfuncptr, are set in the Source ctor
 // that calls g_source_new(const_cast<GSourceFuncs*>(&vfunc_table_), sizeof(GSource)),
 // making it possible to indirectly call the Source::*_vfunc() member functions
@@ -224,6 +509,7 @@ static gboolean
 glibmm_source_callback(void* data)
 {
   SourceConnectionNode* const conn_data = static_cast<SourceConnectionNode*>(data);
+  const DispatchRecorder recorder(nullptr, "Glib::SignalTimeout/SignalIdle");
 
   try
   {
@@ -245,6 +531,7 @@ static gboolean
 glibmm_source_callback_once(void* data)
 {
   SourceConnectionNode* const conn_data = static_cast<SourceConnectionNode*>(data);
+  const DispatchRecorder recorder(nullptr, "Glib::SignalTimeout/SignalIdle");
 
   try
   {
@@ -270,6 +557,7 @@ glibmm_iosource_callback(GIOChannel*, GIOCondition condition, void* data)
 {
   SourceCallbackData* const callback_data = static_cast<SourceCallbackData*>(data);
   g_return_val_if_fail(callback_data->node != nullptr, 0);
+  const DispatchRecorder recorder(nullptr, "Glib::SignalIO");
 
   try
   {
@@ -292,6 +580,7 @@ static gboolean
 glibmm_child_watch_callback(GPid pid, gint child_status, void* data)
 {
   SourceConnectionNode* const conn_data = static_cast<SourceConnectionNode*>(data);
+  const DispatchRecorder recorder(nullptr, "Glib::SignalChildWatch");
 
   try
   {
@@ -323,10 +612,9 @@ glibmm_signal_connect_once(
   g_source_unref(source); // GMainContext holds a reference
 }
 
-extern "C"
-{
+// Used by MainContext::invoke(), also when it calls the slot directly.
 static gboolean
-glibmm_main_context_invoke_callback(void* data)
+call_invoked_slot(void* data)
 {
   sigc::slot_base* const slot = reinterpret_cast<sigc::slot_base*>(data);
 
@@ -342,6 +630,15 @@ glibmm_main_context_invoke_callback(void* data)
   return 0;
 }
 
+extern "C"
+{
+static gboolean
+glibmm_main_context_invoke_callback(void* data)
+{
+  const DispatchRecorder recorder(nullptr, "Glib::MainContext::invoke");
+  return call_invoked_slot(data);
+}
+
 static void
 glibmm_main_context_invoke_destroy_notify_callback(void* data)
 {
@@ -398,6 +695,7 @@ SignalTimeout::connect(const sigc::slot<bool()>& slot, unsigned int interval, in
   const sigc::connection connection(*conn_node->get_slot());
 
   GSource* const source = g_timeout_source_new(interval);
+  g_source_set_static_name(source, "Glib::SignalTimeout");
 
   if (priority != G_PRIORITY_DEFAULT)
     g_source_set_priority(source, priority);
@@ -417,6 +715,7 @@ void
 SignalTimeout::connect_once(const sigc::slot<void()>& slot, unsigned int interval, int priority)
 {
   GSource* const source = g_timeout_source_new(interval);
+  g_source_set_static_name(source, "Glib::SignalTimeout");
   glibmm_signal_connect_once(slot, priority, source, context_);
 }
 
@@ -428,6 +727,7 @@ SignalTimeout::connect_seconds(const sigc::slot<bool()>& slot, unsigned int inte
   const sigc::connection connection(*conn_node->get_slot());
 
   GSource* const source = g_timeout_source_new_seconds(interval);
+  g_source_set_static_name(source, "Glib::SignalTimeout");
 
   if (priority != G_PRIORITY_DEFAULT)
     g_source_set_priority(source, priority);
@@ -448,6 +748,7 @@ SignalTimeout::connect_seconds_once(
   const sigc::slot<void()>& slot, unsigned int interval, int priority)
 {
   GSource* const source = g_timeout_source_new_seconds(interval);
+  g_source_set_static_name(source, "Glib::SignalTimeout");
   glibmm_signal_connect_once(slot, priority, source, context_);
 }
 
@@ -470,6 +771,7 @@ SignalIdle::connect(const sigc::slot<bool()>& slot, int priority)
   const sigc::connection connection(*conn_node->get_slot());
 
   GSource* const source = g_idle_source_new();
+  g_source_set_static_name(source, "Glib::SignalIdle");
 
   if (priority != G_PRIORITY_DEFAULT)
     g_source_set_priority(source, priority);
@@ -489,6 +791,7 @@ void
 SignalIdle::connect_once(const sigc::slot<void()>& slot, int priority)
 {
   GSource* const source = g_idle_source_new();
+  g_source_set_static_name(source, "Glib::SignalIdle");
   glibmm_signal_connect_once(slot, priority, source, context_);
 }
 
@@ -509,6 +812,7 @@ SignalIO::connect(
   const sigc::slot<bool(IOCondition)>& slot, PollFD::fd_t fd, IOCondition condition, int priority)
 {
   const auto source = IOSource::create(fd, condition);
+  g_source_set_static_name(source->gobj(), "Glib::SignalIO");
 
   if (priority != G_PRIORITY_DEFAULT)
     source->set_priority(priority);
@@ -525,6 +829,7 @@ SignalIO::connect(const sigc::slot<bool(IOCondition)>& slot, const Glib::RefPtr<
   IOCondition condition, int priority)
 {
   const auto source = IOSource::create(channel, condition);
+  g_source_set_static_name(source->gobj(), "Glib::SignalIO");
 
   if (priority != G_PRIORITY_DEFAULT)
     source->set_priority(priority);
@@ -555,6 +860,7 @@ SignalChildWatch::connect(const sigc::slot<void(GPid, int)>& slot, GPid pid, int
   const sigc::connection connection(*conn_node->get_slot());
 
   GSource* const source = g_child_watch_source_new(pid);
+  g_source_set_static_name(source, "Glib::SignalChildWatch");
 
   if (priority != G_PRIORITY_DEFAULT)
     g_source_set_priority(source, priority);
@@ -727,8 +1033,38 @@ MainContext::invoke(const sigc::slot<bool()>& slot, int priority)
   // Make a copy of slot on the heap.
   sigc::slot_base* const slot_copy = new sigc::slot<bool()>(slot);
 
-  g_main_context_invoke_full(gobj(), priority, glibmm_main_context_invoke_callback, slot_copy,
-    glibmm_main_context_invoke_destroy_notify_callback);
+  // Like g_main_context_invoke_full(), but the idle source is named, so that
+  // instrumentation records its dispatches under the name of this method.
+  GMainContext* const context = gobj();
+  if (g_main_context_is_owner(context))
+  {
+    while (call_invoked_slot(slot_copy))
+    {
+    }
+    glibmm_main_context_invoke_destroy_notify_callback(slot_copy);
+    return;
+  }
+
+  GMainContext* thread_default = g_main_context_get_thread_default();
+  if (!thread_default)
+    thread_default = g_main_context_default();
+  if (thread_default == context && g_main_context_acquire(context))
+  {
+    while (call_invoked_slot(slot_copy))
+    {
+    }
+    g_main_context_release(context);
+    glibmm_main_context_invoke_destroy_notify_callback(slot_copy);
+    return;
+  }
+
+  GSource* const source = g_idle_source_new();
+  g_source_set_static_name(source, "Glib::MainContext::invoke");
+  g_source_set_priority(source, priority);
+  g_source_set_callback(source, &glibmm_main_context_invoke_callback, slot_copy,
+    &glibmm_main_context_invoke_destroy_notify_callback);
+  g_source_attach(source, context);
+  g_source_unref(source); // GMainContext holds a reference
 }
 
 SignalTimeout
@@ -755,6 +1091,128 @@ MainContext::signal_child_watch()
   return SignalChildWatch(gobj());
 }
 
+void
+MainContext::enable_instrumentation(bool enable)
+{
+  std::unique_lock<std::mutex> lock(instrumentation_mutex);
+  const auto iter = instrumentations.find(gobj());
+
+  if (enable)
+  {
+    if (iter != instrumentations.end())
+      return;
+
+    auto instrumentation = std::make_shared<Instrumentation>(gobj());
+    instrumentations.emplace(gobj(), instrumentation);
+    n_instrumentations = instrumentations.size();
+    ++instrumentations_generation;
+    lock.unlock();
+
+    GSource* const source = g_source_new(&instrumentation_source_funcs, sizeof(InstrumentationSource));
+    auto self = reinterpret_cast<InstrumentationSource*>(source);
+    self->instrumentation = new std::shared_ptr<Instrumentation>(instrumentation);
+    self->check_time_ns = -1;
+    g_source_set_static_name(source, "Glib::MainContext instrumentation");
+    // Prepared and checked before all other sources.
+    g_source_set_priority(source, G_MININT);
+    instrumentation->source_id = g_source_attach(source, gobj());
+    g_source_unref(source); // GMainContext holds a reference
+  }
+  else
+  {
+    if (iter == instrumentations.end())
+      return;
+
+    const unsigned int source_id = iter->second->source_id;
+    instrumentations.erase(iter);
+    n_instrumentations = instrumentations.size();
+    ++instrumentations_generation;
+    // Destroying the source may call its finalize function, which locks the mutex.
+    lock.unlock();
+
+    GSource* const source = g_main_context_find_source_by_id(gobj(), source_id);
+    if (source)
+      g_source_destroy(source);
+  }
+}
+
+bool
+MainContext::is_instrumentation_enabled() const
+{
+  std::lock_guard<std::mutex> lock(instrumentation_mutex);
+  return instrumentations.find(const_cast<GMainContext*>(gobj())) != instrumentations.end();
+}
+
+std::vector<MainContext::SourceStats>
+MainContext::get_source_stats() const
+{
+  std::vector<SourceStats> result;
+  const auto instrumentation = find_instrumentation(const_cast<GMainContext*>(gobj()));
+  if (!instrumentation)
+    return result;
+
+  std::lock_guard<std::mutex> lock(instrumentation->mutex);
+  result.reserve(instrumentation->sources.size());
+  for (const auto& source : instrumentation->sources)
+  {
+    SourceStats stats;
+    stats.name = source.first;
+    stats.dispatch = source.second->dispatch.get_snapshot();
+    stats.lateness = source.second->lateness.get_snapshot();
+    result.emplace_back(std::move(stats));
+  }
+  return result;
+}
+
+LatencyHistogram::Snapshot
+MainContext::get_iteration_stats() const
+{
+  const auto instrumentation = find_instrumentation(const_cast<GMainContext*>(gobj()));
+  return instrumentation ? instrumentation->iterations.get_snapshot() : LatencyHistogram::Snapshot();
+}
+
+void
+MainContext::reset_instrumentation_stats()
+{
+  const auto instrumentation = find_instrumentation(gobj());
+  if (!instrumentation)
+    return;
+
+  instrumentation->iterations.reset();
+  std::lock_guard<std::mutex> lock(instrumentation->mutex);
+  for (auto& source : instrumentation->sources)
+  {
+    source.second->dispatch.reset();
+    source.second->lateness.reset();
+  }
+}
+
+std::string
+MainContext::get_instrumentation_json() const
+{
+  std::string json = "{\"iterations\": ";
+  append_json_snapshot(json, get_iteration_stats());
+  json += ", \"sources\": [";
+
+  bool first = true;
+  for (const auto& stats : get_source_stats())
+  {
+    if (!first)
+      json += ", ";
+    first = false;
+
+    json += "{\"name\": ";
+    append_json_string(json, stats.name);
+    json += ", \"dispatch\": ";
+    append_json_snapshot(json, stats.dispatch);
+    json += ", \"lateness\": ";
+    append_json_snapshot(json, stats.lateness);
+    json += '}';
+  }
+  json += "]}";
+  return json;
+}
+
 void
 MainContext::reference() const
 {
@@ -950,6 +1408,18 @@ Source::get_context()
   return Glib::wrap(g_source_get_context(gobject_), true);
 }
 
+void
+Source::set_name(const Glib::ustring& name)
+{
+  g_source_set_name(gobject_, name.c_str());
+}
+
+Glib::ustring
+Source::get_name() const
+{
+  return Glib::convert_const_gchar_ptr_to_ustring(g_source_get_name(gobject_));
+}
+
 GSource*
 Source::gobj_copy() const
 {
@@ -1102,12 +1572,13 @@ Source::check_vfunc(GSource* source)
 
 // static
 gboolean
-Source::dispatch_vfunc(GSource*, GSourceFunc callback, void* user_data)
+Source::dispatch_vfunc(GSource* source, GSourceFunc callback, void* user_data)
 {
   SourceCallbackData* const callback_data = static_cast<SourceCallbackData*>(user_data);
 
   g_return_val_if_fail(callback == &glibmm_dummy_source_callback, 0);
   g_return_val_if_fail(callback_data != nullptr && callback_data->node != nullptr, 0);
+  const DispatchRecorder recorder(source, "Glib::Source");
 
   try
   {
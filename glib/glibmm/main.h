@@ -21,7 +21,9 @@
 #include <glibmm/priorities.h>
 #include <glibmm/iochannel.h>
 #include <glibmm/enums.h>
+#include <glibmm/latencyhistogram.h>
 #include <sigc++/sigc++.h>
+#include <string>
 #include <vector>
 #include <cstddef>
 #include <atomic>
@@ -637,6 +639,82 @@ public:
    */
   SignalChildWatch signal_child_watch();
 
+  /** Statistics of the dispatches of sources with the same name.
+   * See enable_instrumentation().
+   *
+   * @newin{2,90}
+   */
+  struct SourceStats
+  {
+    /** The name of the sources. See Source::set_name() and g_source_set_name().
+     * Sources created by SignalTimeout, SignalIdle, SignalChildWatch and
+     * invoke() are named after them, unless they have another name.
+     */
+    std::string name;
+    /// The durations of the dispatches, in nanoseconds.
+    LatencyHistogram::Snapshot dispatch;
+    /** The lateness of the dispatches, in nanoseconds: the time from the
+     * source's ready time to the start of the dispatch. Only sources with a
+     * ready time are counted, such as those of SignalTimeout.
+     */
+    LatencyHistogram::Snapshot lateness;
+  };
+
+  /** Enables or disables the instrumentation of this context.
+   *
+   * While the instrumentation is enabled, glibmm records for each source
+   * name how often sources are dispatched, for how long and how late,
+   * and for each iteration of the main loop how long it takes from the end
+   * of the poll until the next iteration starts, i.e. the time spent
+   * checking and dispatching sources. Use this to find the source that
+   * blocks a main loop.
+   *
+   * Only sources whose callbacks are glibmm slots are recorded: those of
+   * SignalTimeout, SignalIdle, SignalIO, SignalChildWatch, invoke() and
+   * Glib::Source. A slot that invoke() calls directly, without a source, is
+   * not recorded. While no context is instrumented, the instrumentation costs
+   * one atomic load per dispatch.
+   *
+   * Disabling the instrumentation discards the statistics.
+   *
+   * @param enable <tt>true</tt> to enable, <tt>false</tt> to disable.
+   *
+   * @newin{2,90}
+   */
+  void enable_instrumentation(bool enable = true);
+
+  /** Checks whether the instrumentation of this context is enabled.
+   * @newin{2,90}
+   */
+  bool is_instrumentation_enabled() const;
+
+  /** Gets the statistics of the dispatched sources, sorted by name.
+   * @return The statistics, or an empty vector if the instrumentation is not enabled.
+   * @newin{2,90}
+   */
+  std::vector<SourceStats> get_source_stats() const;
+
+  /** Gets the statistics of the main loop iterations: the durations, in
+   * nanoseconds, from the end of the poll until the next iteration starts.
+   * @newin{2,90}
+   */
+  LatencyHistogram::Snapshot get_iteration_stats() const;
+
+  /** Clears the statistics of the instrumentation.
+   * @newin{2,90}
+   */
+  void reset_instrumentation_stats();
+
+  /** Gets the statistics of the instrumentation as a JSON object.
+   *
+   * The object contains "iterations", the statistics of get_iteration_stats(),
+   * and "sources", an array with the statistics of get_source_stats().
+   * Durations are in microseconds.
+   *
+   * @newin{2,90}
+   */
+  std::string get_instrumentation_json() const;
+
   void reference() const;
   void unreference() const;
 
@@ -786,6 +864,19 @@ public:
    */
   GLIBMM_API Glib::RefPtr<MainContext> get_context();
 
+  /** Sets a name for the source, used in debugging and profiling.
+   * The name is shown in the statistics of MainContext::enable_instrumentation().
+   * @param name The name of the source.
+   * @newin{2,90}
+   */
+  GLIBMM_API void set_name(const Glib::ustring& name);
+
+  /** Gets the name of the source, as set by set_name().
+   * @return The name, or an empty string if the source has no name.
+   * @newin{2,90}
+   */
+  GLIBMM_API Glib::ustring get_name() const;
+
   GLIBMM_API GSource* gobj() { return gobject_; }
   GLIBMM_API const GSource* gobj() const { return gobject_; }
   GLIBMM_API GSource* gobj_copy() const;
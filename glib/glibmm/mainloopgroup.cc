@@ -0,0 +1,264 @@
+/* Copyright (C) 2026 The glibmm Development Team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <glibmm/mainloopgroup.h>
+#include <glibmm/exceptionhandler.h>
+#include <glib.h>
+#include <algorithm>
+#include <atomic>
+#include <future>
+#include <thread>
+#include <vector>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace
+{
+
+void
+update_max(std::atomic<gint64>& max, gint64 value)
+{
+  gint64 old_max = max.load(std::memory_order_relaxed);
+  while (value > old_max &&
+         !max.compare_exchange_weak(old_max, value, std::memory_order_relaxed))
+  {
+  }
+}
+
+void
+bind_to_cpu(unsigned int cpu)
+{
+#ifdef __linux__
+  cpu_set_t cpu_set;
+  CPU_ZERO(&cpu_set);
+  CPU_SET(cpu, &cpu_set);
+  const int err = pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set);
+  if (err != 0)
+    g_warning("Glib::MainLoopGroup: Can't bind thread to CPU %u: %s", cpu, g_strerror(err));
+#else
+  static_cast<void>(cpu);
+#endif
+}
+
+} // anonymous namespace
+
+namespace Glib
+{
+
+struct MainLoopGroup::Impl
+{
+  struct Loop
+  {
+    Glib::RefPtr<MainContext> context = MainContext::create();
+    Glib::RefPtr<MainLoop> mainloop = MainLoop::create(context);
+    std::thread thread;
+
+    std::atomic<guint64> n_executed{ 0 };
+    std::atomic<guint64> n_pending{ 0 };
+    std::atomic<gint64> total_latency_usec{ 0 };
+    std::atomic<gint64> max_latency_usec{ 0 };
+    std::atomic<gint64> total_run_usec{ 0 };
+    std::atomic<guint64> n_exceptions{ 0 };
+
+    void run(int cpu, std::promise<void>& running);
+  };
+
+  std::vector<std::unique_ptr<Loop>> loops;
+  std::atomic<unsigned int> next_loop{ 0 };
+};
+
+void
+MainLoopGroup::Impl::Loop::run(int cpu, std::promise<void>& running)
+{
+  if (cpu >= 0)
+    bind_to_cpu(cpu);
+
+  // Own the context and make it the thread-default context before the
+  // constructor returns. Then get_context() returns a context that is
+  // owned by its loop's thread, also before the loop has started running.
+  context->acquire();
+  context->push_thread_default();
+  running.set_value();
+  mainloop->run();
+  context->pop_thread_default();
+  context->release();
+}
+
+MainLoopGroup::MainLoopGroup(unsigned int n_loops, bool set_cpu_affinity)
+: impl_(std::make_unique<Impl>())
+{
+  const unsigned int n_cpus = std::max(1u, std::thread::hardware_concurrency());
+  if (n_loops == 0)
+    n_loops = n_cpus;
+
+  impl_->loops.reserve(n_loops);
+  for (unsigned int i = 0; i < n_loops; ++i)
+    impl_->loops.emplace_back(std::make_unique<Impl::Loop>());
+
+  std::vector<std::promise<void>> running(n_loops);
+  for (unsigned int i = 0; i < n_loops; ++i)
+  {
+    auto& loop = *impl_->loops[i];
+    loop.thread = std::thread(&Impl::Loop::run, &loop, set_cpu_affinity ? int(i % n_cpus) : -1,
+      std::ref(running[i]));
+  }
+  for (auto& promise : running)
+    promise.get_future().wait();
+}
+
+MainLoopGroup::~MainLoopGroup() noexcept
+{
+  for (auto& loop : impl_->loops)
+  {
+    // If the loop has not yet started running, a direct call to quit()
+    // would be lost. The invoked slot is executed in the loop.
+    auto mainloop = loop->mainloop;
+    loop->context->invoke([mainloop]() -> bool
+      {
+        mainloop->quit();
+        return false;
+      }, PRIORITY_HIGH);
+  }
+
+  for (auto& loop : impl_->loops)
+    loop->thread.join();
+}
+
+unsigned int
+MainLoopGroup::get_n_loops() const
+{
+  return impl_->loops.size();
+}
+
+Glib::RefPtr<MainContext>
+MainLoopGroup::get_context(unsigned int loop_index) const
+{
+  g_return_val_if_fail(loop_index < impl_->loops.size(), Glib::RefPtr<MainContext>());
+  return impl_->loops[loop_index]->context;
+}
+
+unsigned int
+MainLoopGroup::choose_loop(Balance balance)
+{
+  const auto& loops = impl_->loops;
+  const unsigned int start = impl_->next_loop++ % loops.size();
+  if (balance == Balance::ROUND_ROBIN)
+    return start;
+
+  // Start the search at the round-robin position, so that equally loaded
+  // loops get an even share of the work.
+  unsigned int best = start;
+  guint64 best_pending = loops[start]->n_pending.load(std::memory_order_relaxed);
+  for (std::size_t i = 1; i < loops.size() && best_pending > 0; ++i)
+  {
+    const unsigned int index = (start + i) % loops.size();
+    const guint64 n_pending = loops[index]->n_pending.load(std::memory_order_relaxed);
+    if (n_pending < best_pending)
+    {
+      best = index;
+      best_pending = n_pending;
+    }
+  }
+  return best;
+}
+
+unsigned int
+MainLoopGroup::invoke(const sigc::slot<void()>& slot, Balance balance, int priority)
+{
+  const unsigned int loop_index = choose_loop(balance);
+  invoke_in(loop_index, slot, priority);
+  return loop_index;
+}
+
+void
+MainLoopGroup::invoke_in(unsigned int loop_index, const sigc::slot<void()>& slot, int priority)
+{
+  g_return_if_fail(loop_index < impl_->loops.size());
+
+  Impl::Loop* const loop = impl_->loops[loop_index].get();
+  ++loop->n_pending;
+  const gint64 invoke_time = g_get_monotonic_time();
+
+  loop->context->invoke([loop, slot, invoke_time]() -> bool
+    {
+      const gint64 start_time = g_get_monotonic_time();
+      const gint64 latency = start_time - invoke_time;
+      loop->total_latency_usec.fetch_add(latency, std::memory_order_relaxed);
+      update_max(loop->max_latency_usec, latency);
+
+      try
+      {
+        slot();
+      }
+      catch (...)
+      {
+        ++loop->n_exceptions;
+        Glib::exception_handlers_invoke();
+      }
+
+      loop->total_run_usec.fetch_add(g_get_monotonic_time() - start_time, std::memory_order_relaxed);
+      ++loop->n_executed;
+      --loop->n_pending;
+      return false;
+    }, priority);
+}
+
+void
+MainLoopGroup::add_exception_handler(const sigc::slot<void()>& slot)
+{
+  // PRIORITY_HIGH: Install the handler before slots that are invoked
+  // after this call, with a lower priority, are executed.
+  for (auto& loop : impl_->loops)
+    loop->context->invoke([slot]() -> bool
+      {
+        Glib::add_exception_handler(slot);
+        return false;
+      }, PRIORITY_HIGH);
+}
+
+MainLoopGroup::LoopStats
+MainLoopGroup::get_loop_stats(unsigned int loop_index) const
+{
+  LoopStats stats;
+  g_return_val_if_fail(loop_index < impl_->loops.size(), stats);
+
+  const auto& loop = *impl_->loops[loop_index];
+  stats.n_executed = loop.n_executed;
+  stats.n_pending = loop.n_pending;
+  stats.total_latency_usec = loop.total_latency_usec;
+  stats.max_latency_usec = loop.max_latency_usec;
+  stats.total_run_usec = loop.total_run_usec;
+  stats.n_exceptions = loop.n_exceptions;
+  return stats;
+}
+
+void
+MainLoopGroup::reset_stats()
+{
+  for (auto& loop : impl_->loops)
+  {
+    loop->n_executed = 0;
+    loop->total_latency_usec = 0;
+    loop->max_latency_usec = 0;
+    loop->total_run_usec = 0;
+    loop->n_exceptions = 0;
+  }
+}
+
+} // namespace Glib
@@ -0,0 +1,164 @@
+#ifndef _GLIBMM_MAINLOOPGROUP_H
+#define _GLIBMM_MAINLOOPGROUP_H
+
+/* Copyright (C) 2026 The glibmm Development Team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <glibmmconfig.h>
+#include <glibmm/main.h>
+#include <glibmm/priorities.h>
+#include <glibmm/refptr.h>
+#include <sigc++/sigc++.h>
+#include <memory>
+
+namespace Glib
+{
+
+/** A group of main loops, each running in its own thread.
+ *
+ * %MainLoopGroup owns one MainContext and one MainLoop per thread, usually one
+ * per processor. In each thread the loop's context is the thread-default
+ * main context, so asynchronous GIO operations started from a slot invoked
+ * in a loop also complete in that loop.
+ *
+ * Work is distributed with invoke(), either round-robin or to the loop with
+ * the fewest pending invocations. For each loop the group measures the
+ * latency from invoke() to the start of the slot, which shows whether a
+ * loop is overloaded or blocked.
+ *
+ * @code
+ * Glib::MainLoopGroup group; // One loop per processor.
+ * group.invoke([]() { handle_request(); }, Glib::MainLoopGroup::Balance::LEAST_LOADED);
+ * @endcode
+ *
+ * An exception thrown by an invoked slot is handed to the exception handlers
+ * of the thread that runs the loop. Exception handlers are per thread, so
+ * the handlers installed with Glib::add_exception_handler() in the thread
+ * that creates the group are not used. Install them with add_exception_handler().
+ *
+ * The threads are started by the constructor and stopped by the destructor.
+ * The methods of %MainLoopGroup are thread-safe.
+ *
+ * @newin{2,90}
+ * @ingroup MainLoop
+ */
+class GLIBMM_API MainLoopGroup
+{
+public:
+  /// How invoke() chooses a loop.
+  enum class Balance
+  {
+    ROUND_ROBIN,  ///< The loops are chosen in turn.
+    LEAST_LOADED  ///< The loop with the fewest invoked slots that have not yet finished.
+  };
+
+  /** Statistics of one loop. Latencies are in microseconds.
+   */
+  struct LoopStats
+  {
+    /// Number of slots that have been executed.
+    guint64 n_executed = 0;
+    /// Number of slots that have been invoked but not yet finished.
+    guint64 n_pending = 0;
+    /// Sum of the latencies from invoke() to the start of the slot.
+    gint64 total_latency_usec = 0;
+    /// Maximum latency from invoke() to the start of the slot.
+    gint64 max_latency_usec = 0;
+    /// Sum of the execution times of the slots.
+    gint64 total_run_usec = 0;
+    /// Number of executed slots that have thrown an exception.
+    guint64 n_exceptions = 0;
+
+    /// Mean latency from invoke() to the start of the slot.
+    double get_mean_latency_usec() const
+    { return n_executed ? static_cast<double>(total_latency_usec) / n_executed : 0.0; }
+  };
+
+  /** Creates a group and starts its threads.
+   * @param n_loops The number of loops. If 0, one loop per processor is created.
+   * @param set_cpu_affinity If <tt>true</tt>, loop number i is bound to processor
+   *        number i modulo the number of processors, where the platform
+   *        supports it (currently Linux).
+   */
+  explicit MainLoopGroup(unsigned int n_loops = 0, bool set_cpu_affinity = false);
+
+  /** Stops all loops and joins their threads.
+   * Slots that have been invoked but not yet executed are discarded.
+   */
+  ~MainLoopGroup() noexcept;
+
+  // noncopyable
+  MainLoopGroup(const MainLoopGroup&) = delete;
+  MainLoopGroup& operator=(const MainLoopGroup&) = delete;
+
+  unsigned int get_n_loops() const;
+
+  /** Gets the main context of a loop.
+   * @param loop_index 0 <= @a loop_index < get_n_loops().
+   */
+  Glib::RefPtr<MainContext> get_context(unsigned int loop_index) const;
+
+  /** Chooses a loop, as invoke() does.
+   * @return The index of the chosen loop.
+   */
+  unsigned int choose_loop(Balance balance = Balance::ROUND_ROBIN);
+
+  /** Invokes a slot in one of the loops.
+   * @param slot The slot to invoke.
+   * @param balance How the loop is chosen.
+   * @param priority The priority of the idle source that invokes @a slot.
+   * @return The index of the loop that @a slot was sent to.
+   */
+  unsigned int invoke(const sigc::slot<void()>& slot, Balance balance = Balance::ROUND_ROBIN,
+    int priority = PRIORITY_DEFAULT);
+
+  /** Invokes a slot in a specific loop.
+   * @param loop_index 0 <= @a loop_index < get_n_loops().
+   * @param slot The slot to invoke.
+   * @param priority The priority of the idle source that invokes @a slot.
+   */
+  void invoke_in(unsigned int loop_index, const sigc::slot<void()>& slot,
+    int priority = PRIORITY_DEFAULT);
+
+  /** Adds an exception handler to the thread of each loop.
+   *
+   * The handler is called, as described for Glib::add_exception_handler(),
+   * when an invoked slot throws an exception. Without a handler that handles
+   * the exception, a std::exception aborts the program, as it does when it's
+   * thrown by a signal handler. The handler is copied into each loop's thread,
+   * and it's installed before slots that are invoked after this call are executed.
+   *
+   * @param slot The exception handler. It may be called from several threads
+   *        at the same time.
+   */
+  void add_exception_handler(const sigc::slot<void()>& slot);
+
+  /** Gets the statistics of a loop.
+   * @param loop_index 0 <= @a loop_index < get_n_loops().
+   */
+  LoopStats get_loop_stats(unsigned int loop_index) const;
+
+  /// Resets the counters and latencies of all loops, except the number of pending slots.
+  void reset_stats();
+
+private:
+  struct Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+} // namespace Glib
+
+#endif /* _GLIBMM_MAINLOOPGROUP_H */
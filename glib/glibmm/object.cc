@@ -109,6 +109,173 @@ ConstructParams::~ConstructParams() noexcept
   g_free(parameter_values);
 }
 
+GValue*
+ConstructParams::add_parameter_(const char* name, const char** names, GValue* values)
+{
+  // Like the varargs constructor, but the GParamSpecs are cached
+  // and the arrays are provided by StackConstructParams.
+  GParamSpec* const pspec = PropertyIdBase::find_cached(glibmm_class.get_type(), name);
+  if (!pspec)
+  {
+    g_warning("Glib::StackConstructParams::StackConstructParams(): "
+              "object class \"%s\" has no property named \"%s\"",
+      g_type_name(glibmm_class.get_type()), name);
+    return nullptr;
+  }
+
+  parameter_names = names;
+  parameter_values = values;
+
+  GValue* const value = &values[n_parameters];
+  names[n_parameters] = name;
+  value->g_type = 0;
+  g_value_init(value, G_PARAM_SPEC_VALUE_TYPE(pspec));
+  ++n_parameters;
+  return value;
+}
+
+void
+ConstructParams::clear_parameters_() noexcept
+{
+  // The arrays are not owned. Don't let the destructor free them.
+  while (n_parameters > 0)
+    g_value_unset(&parameter_values[--n_parameters]);
+  parameter_names = nullptr;
+  parameter_values = nullptr;
+}
+
+namespace
+{
+
+template <class T>
+void
+set_numeric_parameter(GValue* value, T v)
+{
+  switch (G_TYPE_FUNDAMENTAL(G_VALUE_TYPE(value)))
+  {
+  case G_TYPE_BOOLEAN:
+    g_value_set_boolean(value, v != 0);
+    break;
+  case G_TYPE_CHAR:
+    g_value_set_schar(value, v);
+    break;
+  case G_TYPE_UCHAR:
+    g_value_set_uchar(value, v);
+    break;
+  case G_TYPE_INT:
+    g_value_set_int(value, v);
+    break;
+  case G_TYPE_UINT:
+    g_value_set_uint(value, v);
+    break;
+  case G_TYPE_LONG:
+    g_value_set_long(value, v);
+    break;
+  case G_TYPE_ULONG:
+    g_value_set_ulong(value, v);
+    break;
+  case G_TYPE_INT64:
+    g_value_set_int64(value, v);
+    break;
+  case G_TYPE_UINT64:
+    g_value_set_uint64(value, v);
+    break;
+  case G_TYPE_ENUM:
+    g_value_set_enum(value, v);
+    break;
+  case G_TYPE_FLAGS:
+    g_value_set_flags(value, v);
+    break;
+  case G_TYPE_FLOAT:
+    g_value_set_float(value, v);
+    break;
+  case G_TYPE_DOUBLE:
+    g_value_set_double(value, v);
+    break;
+  default:
+    g_warning("Glib::StackConstructParams: Can't store a number in a value of type %s",
+      G_VALUE_TYPE_NAME(value));
+    break;
+  }
+}
+
+} // anonymous namespace
+
+// static
+void
+ConstructParams::set_parameter_(GValue* value, gint64 v_int)
+{
+  set_numeric_parameter(value, v_int);
+}
+
+// static
+void
+ConstructParams::set_parameter_(GValue* value, guint64 v_uint)
+{
+  set_numeric_parameter(value, v_uint);
+}
+
+// static
+void
+ConstructParams::set_parameter_(GValue* value, double v_double)
+{
+  set_numeric_parameter(value, v_double);
+}
+
+// static
+void
+ConstructParams::set_parameter_(GValue* value, const char* v_string)
+{
+  if (G_VALUE_HOLDS_STRING(value))
+    g_value_set_string(value, v_string);
+  else
+    g_warning("Glib::StackConstructParams: Can't store a string in a value of type %s",
+      G_VALUE_TYPE_NAME(value));
+}
+
+// static
+void
+ConstructParams::set_parameter_(GValue* value, void* v_pointer)
+{
+  switch (G_TYPE_FUNDAMENTAL(G_VALUE_TYPE(value)))
+  {
+  case G_TYPE_OBJECT:
+  case G_TYPE_INTERFACE:
+    g_value_set_object(value, v_pointer);
+    break;
+  case G_TYPE_BOXED:
+    g_value_set_boxed(value, v_pointer);
+    break;
+  case G_TYPE_POINTER:
+    g_value_set_pointer(value, v_pointer);
+    break;
+  case G_TYPE_PARAM:
+    g_value_set_param(value, static_cast<GParamSpec*>(v_pointer));
+    break;
+  case G_TYPE_VARIANT:
+    g_value_set_variant(value, static_cast<GVariant*>(v_pointer));
+    break;
+  case G_TYPE_STRING:
+    g_value_set_string(value, static_cast<const char*>(v_pointer));
+    break;
+  default:
+    g_warning("Glib::StackConstructParams: Can't store a pointer in a value of type %s",
+      G_VALUE_TYPE_NAME(value));
+    break;
+  }
+}
+
+// static
+void
+ConstructParams::set_parameter_(GValue* value, const GValue* v_value)
+{
+  if (g_value_type_transformable(G_VALUE_TYPE(v_value), G_VALUE_TYPE(value)))
+    g_value_transform(v_value, value);
+  else
+    g_warning("Glib::StackConstructParams: Can't store a value of type %s in a value of type %s",
+      G_VALUE_TYPE_NAME(v_value), G_VALUE_TYPE_NAME(value));
+}
+
 /**** Glib::Object_Class ***************************************************/
 
 const Glib::Class&
@@ -34,6 +34,9 @@
 #include <glibmm/containerhandle_shared.h> /* Because its specializations may be here. */
 #include <glibmm/value.h>
 #include <glib.h> // for G_GNUC_NULL_TERMINATED and GDestroyNotify
+#include <cstddef>
+#include <string>
+#include <type_traits>
 
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
 extern "C" {
@@ -81,8 +84,98 @@ public:
 
   ConstructParams(const ConstructParams& other) = delete;
   ConstructParams& operator=(const ConstructParams&) = delete;
+
+protected:
+  // Used by StackConstructParams.
+  GValue* add_parameter_(const char* name, const char** names, GValue* values);
+  void clear_parameters_() noexcept;
+  static void set_parameter_(GValue* value, gint64 v_int);
+  static void set_parameter_(GValue* value, guint64 v_uint);
+  static void set_parameter_(GValue* value, double v_double);
+  static void set_parameter_(GValue* value, const char* v_string);
+  static void set_parameter_(GValue* value, void* v_pointer);
+  static void set_parameter_(GValue* value, const GValue* v_value);
+};
+
+/* StackConstructParams is a ConstructParams that keeps the parameter names and
+ * values in the object itself, usually on the stack, instead of allocating
+ * them. The values are C++ arguments instead of varargs, and the properties'
+ * GParamSpecs are looked up with PropertyIdBase::find_cached(). Use it
+ * instead of ConstructParams where many objects are created:
+ *
+ *   MyObject::MyObject(int id, const Glib::ustring& label)
+ *   : Glib::ObjectBase(nullptr),
+ *     Glib::Object(Glib::StackConstructParams(myobject_class_.init(),
+ *       "id", id, "label", label))
+ *
+ * The arguments after the class are pairs of a property name and a value.
+ * A value can be a bool, an integer or an enumeration, a floating point number,
+ * a string (const char*, std::string or Glib::ustring), a pointer (e.g. a
+ * GObject*) or a Glib::ValueBase. It's converted as G_VALUE_COLLECT() in
+ * g_object_new() converts it, according to the fundamental type of the
+ * property. The property names are assumed to be static strings, as in
+ * ConstructParams.
+ */
+template <std::size_t N>
+class StackConstructParams : public ConstructParams
+{
+public:
+  template <class... NamesAndValues>
+  explicit StackConstructParams(const Glib::Class& glibmm_class_,
+    const NamesAndValues&... names_and_values)
+  : ConstructParams(glibmm_class_)
+  {
+    static_assert(sizeof...(NamesAndValues) == 2 * N,
+      "StackConstructParams: Expected pairs of property names and values");
+    add_(names_and_values...);
+  }
+
+  ~StackConstructParams() noexcept { clear_parameters_(); }
+
+private:
+  void add_() {}
+
+  template <class T, class... NamesAndValues>
+  void add_(const char* name, const T& value, const NamesAndValues&... names_and_values)
+  {
+    if (GValue* const g_value = add_parameter_(name, names_, values_))
+      set_(g_value, value);
+    add_(names_and_values...);
+  }
+
+  template <class T>
+  static void set_(GValue* g_value, const T& value)
+  {
+    if constexpr (std::is_base_of_v<Glib::ValueBase, T>)
+      set_parameter_(g_value, value.gobj());
+    else if constexpr (std::is_null_pointer_v<T>)
+      set_parameter_(g_value, static_cast<void*>(nullptr));
+    else if constexpr (std::is_convertible_v<const T&, const char*>)
+      set_parameter_(g_value, static_cast<const char*>(value));
+    else if constexpr (std::is_same_v<T, std::string> || std::is_same_v<T, Glib::ustring>)
+      set_parameter_(g_value, value.c_str());
+    else if constexpr (std::is_enum_v<T>)
+      set_parameter_(g_value, static_cast<gint64>(value));
+    else if constexpr (std::is_integral_v<T> && std::is_signed_v<T>)
+      set_parameter_(g_value, static_cast<gint64>(value));
+    else if constexpr (std::is_integral_v<T>)
+      set_parameter_(g_value, static_cast<guint64>(value));
+    else if constexpr (std::is_floating_point_v<T>)
+      set_parameter_(g_value, static_cast<double>(value));
+    else if constexpr (std::is_pointer_v<T>)
+      set_parameter_(g_value, const_cast<void*>(static_cast<const void*>(value)));
+    else
+      static_assert(std::is_void_v<T>, "StackConstructParams: Unsupported value type");
+  }
+
+  const char* names_[N > 0 ? N : 1];
+  GValue values_[N > 0 ? N : 1];
 };
 
+template <class... NamesAndValues>
+StackConstructParams(const Glib::Class&, const NamesAndValues&...)
+  -> StackConstructParams<sizeof...(NamesAndValues) / 2>;
+
 #endif /* DOXYGEN_SHOULD_SKIP_THIS */
 
 class GLIBMM_API Object : virtual public ObjectBase
@@ -21,6 +21,8 @@
 #include <glibmm/propertyproxy_base.h> //For PropertyProxyConnectionNode
 #include <glibmm/interface.h>
 #include <glibmm/private/interface_p.h>
+#include <cstdint>
+#include <cstring>
 #include <utility> // For std::move()
 
 namespace
@@ -44,6 +46,151 @@ static void ObjectBase_destroy_notify_callback(void* data)
 }
 } // extern "C"
 
+// Whether the class of type has overridden pspec with g_object_class_override_property(),
+// or inherits such an override. g_object_class_find_property() returns the redirect
+// target of an override, so that case can't be told from pspec itself.
+bool
+is_overridden_property(GType type, const GParamSpec* pspec)
+{
+  guint n_properties = 0;
+  GParamSpec** const pspecs = g_object_class_list_properties(
+    static_cast<GObjectClass*>(g_type_class_peek(type)), &n_properties);
+
+  bool overridden = false;
+  for (guint i = 0; i < n_properties; ++i)
+  {
+    if (pspecs[i] != pspec && std::strcmp(pspecs[i]->name, pspec->name) == 0)
+    {
+      overridden = true;
+      break;
+    }
+  }
+  g_free(pspecs);
+  return overridden;
+}
+
+// A small per-thread cache of the classes whose set_property and get_property
+// functions can be called directly, indexed by the object's type and the GParamSpec.
+class DirectPropertyCache
+{
+public:
+  ~DirectPropertyCache()
+  {
+    for (auto& entry : entries_)
+      if (entry.pspec)
+        g_param_spec_unref(entry.pspec);
+  }
+
+  GObjectClass* find(GType type, const GParamSpec* pspec)
+  {
+    Entry& entry = entries_[(reinterpret_cast<std::uintptr_t>(pspec) / 8 ^ type / 4) % size];
+    if (entry.type == type && entry.pspec == pspec)
+      return entry.klass;
+
+    GObjectClass* const klass = is_overridden_property(type, pspec)
+      ? nullptr
+      : static_cast<GObjectClass*>(g_type_class_peek(pspec->owner_type));
+
+    // The reference keeps pspec from being replaced by another one at the same address.
+    g_param_spec_ref(const_cast<GParamSpec*>(pspec));
+    if (entry.pspec)
+      g_param_spec_unref(entry.pspec);
+    entry = { type, const_cast<GParamSpec*>(pspec), klass };
+    return klass;
+  }
+
+private:
+  struct Entry
+  {
+    GType type = 0;
+    GParamSpec* pspec = nullptr;
+    GObjectClass* klass = nullptr;
+  };
+
+  static constexpr std::size_t size = 64;
+  Entry entries_[size];
+};
+
+thread_local DirectPropertyCache direct_property_cache;
+
+// Returns the class whose set_property or get_property function can be called
+// directly for pspec, or nullptr if g_object_set_property() or
+// g_object_get_property() must be called, because the object's class overrides
+// the property, or because they print a warning.
+GObjectClass*
+get_direct_property_class(
+  GObject* object, const GParamSpec* pspec, GParamFlags required, GParamFlags forbidden)
+{
+  if ((pspec->flags & (required | forbidden)) != required ||
+      !G_TYPE_CHECK_INSTANCE_TYPE(object, pspec->owner_type))
+    return nullptr;
+
+  return direct_property_cache.find(G_OBJECT_TYPE(object), pspec);
+}
+
+GParamSpec*
+find_property(GType object_type, const char* property_name)
+{
+  if (G_TYPE_IS_INTERFACE(object_type))
+    return g_object_interface_find_property(
+      g_type_default_interface_get(object_type), property_name);
+
+  g_return_val_if_fail(G_TYPE_IS_OBJECT(object_type), nullptr);
+  return g_object_class_find_property(
+    static_cast<GObjectClass*>(g_type_class_get(object_type)), property_name);
+}
+
+// A small per-thread cache of GParamSpecs, indexed by the object's type and
+// the address of the property name, which is usually a static string.
+class PropertyCache
+{
+public:
+  ~PropertyCache()
+  {
+    for (auto& entry : entries_)
+      if (entry.pspec)
+        g_param_spec_unref(entry.pspec);
+  }
+
+  GParamSpec* find(GType type, const char* property_name)
+  {
+    Entry& entry = entries_[(reinterpret_cast<std::uintptr_t>(property_name) / 8 ^ type / 4) % size];
+
+    // A name at the same address may be a different string,
+    // if it's not a static string.
+    if (entry.type == type && entry.name == property_name &&
+        std::strcmp(entry.pspec->name, property_name) == 0)
+      return entry.pspec;
+
+    GParamSpec* const pspec = find_property(type, property_name);
+
+    // Names that are not canonical, such as "property_name" instead of
+    // "property-name", would not pass the check above. Don't cache them.
+    if (pspec && std::strcmp(pspec->name, property_name) == 0)
+    {
+      // The reference keeps pspec->name valid, even if a dynamic type is unloaded.
+      g_param_spec_ref(pspec);
+      if (entry.pspec)
+        g_param_spec_unref(entry.pspec);
+      entry = { type, property_name, pspec };
+    }
+    return pspec;
+  }
+
+private:
+  struct Entry
+  {
+    GType type = 0;
+    const char* name = nullptr;
+    GParamSpec* pspec = nullptr;
+  };
+
+  static constexpr std::size_t size = 64;
+  Entry entries_[size];
+};
+
+thread_local PropertyCache property_cache;
+
 } // anonymous namespace
 
 namespace Glib
@@ -364,6 +511,73 @@ ObjectBase::get_property_value(const Glib::ustring& property_name, Glib::ValueBa
   g_object_get_property(const_cast<GObject*>(gobj()), property_name.c_str(), value.gobj());
 }
 
+void
+ObjectBase::set_property_value(const GParamSpec* pspec, const Glib::ValueBase& value)
+{
+  g_return_if_fail(pspec != nullptr);
+
+  GObject* const object = gobj();
+  GParamSpec* const param = const_cast<GParamSpec*>(pspec);
+  GObjectClass* const klass = get_direct_property_class(object, pspec, G_PARAM_WRITABLE,
+    GParamFlags(G_PARAM_CONSTRUCT_ONLY | G_PARAM_DEPRECATED));
+
+  if (!klass || G_VALUE_TYPE(value.gobj()) != pspec->value_type ||
+      !g_param_value_is_valid(param, value.gobj()))
+  {
+    // g_object_set_property() converts and validates the value, or reports the error.
+    g_object_set_property(object, pspec->name, value.gobj());
+    return;
+  }
+
+  // What g_object_set_property() does, without looking up the name.
+  // Notifications from the set_property function are queued, as there.
+  g_object_freeze_notify(object);
+  klass->set_property(object, pspec->param_id, value.gobj(), param);
+  if ((pspec->flags & (G_PARAM_EXPLICIT_NOTIFY | G_PARAM_READABLE)) == G_PARAM_READABLE)
+    g_object_notify_by_pspec(object, param);
+  g_object_thaw_notify(object);
+}
+
+void
+ObjectBase::get_property_value(const GParamSpec* pspec, Glib::ValueBase& value) const
+{
+  g_return_if_fail(pspec != nullptr);
+
+  GObject* const object = const_cast<GObject*>(gobj());
+  GObjectClass* const klass =
+    get_direct_property_class(object, pspec, G_PARAM_READABLE, G_PARAM_DEPRECATED);
+
+  if (!klass || G_VALUE_TYPE(value.gobj()) != pspec->value_type)
+  {
+    g_object_get_property(object, pspec->name, value.gobj());
+    return;
+  }
+
+  g_value_reset(value.gobj());
+  klass->get_property(object, pspec->param_id, value.gobj(), const_cast<GParamSpec*>(pspec));
+}
+
+PropertyIdBase::PropertyIdBase(GType object_type, const char* property_name)
+: pspec_(find_property(object_type, property_name))
+{
+  if (!pspec_)
+    g_warning("Glib::PropertyId: Type %s has no property named %s",
+      g_type_name(object_type), property_name);
+}
+
+// static
+GParamSpec*
+PropertyIdBase::find_cached(GType object_type, const char* property_name)
+{
+  return property_cache.find(object_type, property_name);
+}
+
+const char*
+PropertyIdBase::get_name() const
+{
+  return pspec_ ? pspec_->name : nullptr;
+}
+
 sigc::connection
 ObjectBase::connect_property_changed(
   const Glib::ustring& property_name, const sigc::slot<void()>& slot)
@@ -390,6 +604,35 @@ ObjectBase::connect_property_changed(
   return pConnectionNode->connect_changed(property_name);
 }
 
+NotifyBatch::NotifyBatch(ObjectBase& object)
+{
+  add(object);
+}
+
+NotifyBatch::NotifyBatch(std::initializer_list<ObjectBase*> objects)
+{
+  objects_.reserve(objects.size());
+  for (ObjectBase* object : objects)
+    add(*object);
+}
+
+NotifyBatch::~NotifyBatch() noexcept
+{
+  for (auto it = objects_.rbegin(); it != objects_.rend(); ++it)
+  {
+    (*it)->thaw_notify();
+    (*it)->unreference();
+  }
+}
+
+void
+NotifyBatch::add(ObjectBase& object)
+{
+  object.reference();
+  object.freeze_notify();
+  objects_.emplace_back(&object);
+}
+
 void
 ObjectBase::freeze_notify()
 {
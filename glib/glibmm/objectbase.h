@@ -27,11 +27,14 @@
 #include <glibmm/debug.h>
 #include <sigc++/trackable.h>
 #include <typeinfo>
+#include <initializer_list>
 #include <memory>
+#include <vector>
 
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
 extern "C" {
 using GObject = struct _GObject;
+using GParamSpec = struct _GParamSpec;
 }
 #endif
 
@@ -43,6 +46,82 @@ class GLIBMM_API GSigConnectionNode;
 class GLIBMM_API Interface_Class;
 #endif
 
+/** Base class of PropertyId<T>.
+ *
+ * @newin{2,90}
+ */
+class GLIBMM_API PropertyIdBase
+{
+public:
+  /// Returns <tt>true</tt> if the property was found.
+  explicit operator bool() const { return pspec_ != nullptr; }
+
+  /// Returns the canonical name of the property, or <tt>nullptr</tt>.
+  const char* get_name() const;
+
+  GParamSpec* gobj() const { return pspec_; }
+
+  /** Looks up a property, with a small per-thread cache.
+   *
+   * The cache is indexed by @a object_type and the address of @a property_name.
+   * It's most effective when @a property_name is a static string with
+   * the canonical name of the property, such as "property-name".
+   * Unlike the constructor of PropertyId, it prints no warning if
+   * there is no such property.
+   *
+   * @param object_type An object type or an interface type.
+   * @param property_name The name of the property.
+   * @return The GParamSpec, or <tt>nullptr</tt>. The caller does not get a reference.
+   */
+  static GParamSpec* find_cached(GType object_type, const char* property_name);
+
+protected:
+  PropertyIdBase() = default;
+  PropertyIdBase(GType object_type, const char* property_name);
+
+  GParamSpec* pspec_ = nullptr;
+};
+
+/** A resolved property of an object type, for fast repeated access.
+ *
+ * ObjectBase::set_property() and ObjectBase::get_property() with a property
+ * name look up the property's GParamSpec in every call. A %PropertyId does
+ * the lookup once. With ObjectBase::set_property(const PropertyId<PropertyType>&,
+ * const PropertyType&) and ObjectBase::get_property(const PropertyId<PropertyType>&)
+ * the property's set and get functions are called directly, if that is
+ * equivalent to g_object_set_property() and g_object_get_property().
+ *
+ * @code
+ * static const Glib::PropertyId<int> margin_id(Gtk::Widget::get_base_type(), "margin-top");
+ * widget->set_property(margin_id, 6);
+ * @endcode
+ *
+ * %PropertyId does not own a reference to the GParamSpec. It shall not be used
+ * after the type that defines the property has been unloaded, which can
+ * only happen to types registered by a plugin.
+ *
+ * @tparam PropertyType The C++ type of the property, for instance <tt>int</tt>
+ *         or <tt>Glib::ustring</tt>, as in Glib::Value<PropertyType>.
+ *
+ * @newin{2,90}
+ */
+template <class PropertyType>
+class PropertyId : public PropertyIdBase
+{
+public:
+  /// Creates an empty %PropertyId.
+  PropertyId() = default;
+
+  /** Looks up a property.
+   * If the type has no such property, a warning is printed,
+   * and the %PropertyId is empty.
+   * @param object_type An object type or an interface type.
+   * @param property_name The name of the property.
+   */
+  PropertyId(GType object_type, const char* property_name)
+  : PropertyIdBase(object_type, property_name) {}
+};
+
 // This inherits virtually from sigc::trackable so that people can multiply inherit glibmm classes
 // from other sigc::trackable-derived classes.
 // See bugzilla.gnome.org bug # 116280
@@ -129,6 +208,40 @@ public:
   template <class PropertyType>
   PropertyType get_property(const Glib::ustring& property_name) const;
 
+  /** Sets a property, given its GParamSpec.
+   *
+   * If the value has the property's value type, the property is neither
+   * construct-only nor deprecated, and the object's class does not override
+   * it with g_object_class_override_property(), the set_property function of
+   * the class that installed the property is called directly, and
+   * notify is emitted like g_object_set_property() does.
+   * Otherwise g_object_set_property() is called.
+   *
+   * @newin{2,90}
+   */
+  void set_property_value(const GParamSpec* pspec, const Glib::ValueBase& value);
+
+  /** Gets a property, given its GParamSpec.
+   *
+   * Like set_property_value(const GParamSpec*, const Glib::ValueBase&),
+   * the class's get_property function is called directly if possible.
+   *
+   * @newin{2,90}
+   */
+  void get_property_value(const GParamSpec* pspec, Glib::ValueBase& value) const;
+
+  /** Sets a property without looking it up by name.
+   * @newin{2,90}
+   */
+  template <class PropertyType>
+  void set_property(const PropertyId<PropertyType>& property, const PropertyType& value);
+
+  /** Gets a property without looking it up by name.
+   * @newin{2,90}
+   */
+  template <class PropertyType>
+  PropertyType get_property(const PropertyId<PropertyType>& property) const;
+
   /** You can use the signal_changed() signal of the property proxy instead.
    */
   sigc::connection connect_property_changed(const Glib::ustring& property_name, const sigc::slot<void()>& slot);
@@ -292,8 +405,74 @@ ObjectBase::get_property(const Glib::ustring& property_name) const
   return value;
 }
 
+template <class PropertyType>
+inline void
+ObjectBase::set_property(const PropertyId<PropertyType>& property, const PropertyType& value)
+{
+  Glib::Value<PropertyType> property_value;
+  property_value.init(Glib::Value<PropertyType>::value_type());
+
+  property_value.set(value);
+  this->set_property_value(property.gobj(), property_value);
+}
+
+template <class PropertyType>
+inline PropertyType
+ObjectBase::get_property(const PropertyId<PropertyType>& property) const
+{
+  Glib::Value<PropertyType> property_value;
+  property_value.init(Glib::Value<PropertyType>::value_type());
+
+  this->get_property_value(property.gobj(), property_value);
+
+  return property_value.get();
+}
+
 #endif /* DOXYGEN_SHOULD_SKIP_THIS */
 
+/** Combines the "notify" signals of one or more objects.
+ *
+ * While a %NotifyBatch exists, the notify signals of its objects are frozen
+ * with ObjectBase::freeze_notify(). When it's destroyed, the notify signals are
+ * thawed, and each changed property is notified once, however often it was
+ * set in between.
+ *
+ * @code
+ * {
+ *   Glib::NotifyBatch batch{ &row, &summary };
+ *   row.property_name() = name;
+ *   row.property_count() = count;
+ *   summary.property_total() = total;
+ * } // Notifications are emitted here.
+ * @endcode
+ *
+ * The objects are referenced until the %NotifyBatch is destroyed.
+ *
+ * @newin{2,90}
+ */
+class GLIBMM_API NotifyBatch
+{
+public:
+  /// Freezes the notify signal of @a object.
+  explicit NotifyBatch(ObjectBase& object);
+
+  /// Freezes the notify signals of @a objects.
+  NotifyBatch(std::initializer_list<ObjectBase*> objects);
+
+  /// Thaws the notify signals, in the reverse order of freezing.
+  ~NotifyBatch() noexcept;
+
+  // noncopyable
+  NotifyBatch(const NotifyBatch&) = delete;
+  NotifyBatch& operator=(const NotifyBatch&) = delete;
+
+  /// Freezes the notify signal of one more object.
+  void add(ObjectBase& object);
+
+private:
+  std::vector<ObjectBase*> objects_;
+};
+
 GLIBMM_API
 bool _gobject_cppinstance_already_deleted(GObject* gobject);
 
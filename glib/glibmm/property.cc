@@ -19,6 +19,7 @@
 #include <glibmm/object.h>
 #include <glibmm/class.h>
 #include <cstddef>
+#include <cstring>
 #include <map>
 
 // Temporary hack till GLib gets fixed.
@@ -113,6 +114,39 @@ static void destroy_notify_obj_custom_props(void* data)
 }
 } // extern "C"
 
+// The quark used for storing/getting the equality functions of custom value types.
+static const GQuark value_equal_func_quark =
+  g_quark_from_string("glibmm_Property_value_equal_func");
+
+// Returns true if param_spec has G_PARAM_EXPLICIT_NOTIFY, and the values are equal.
+// Then the property shall be neither set nor notified.
+bool
+is_unchanged(GParamSpec* param_spec, const GValue* value1, const GValue* value2)
+{
+  if (!(param_spec->flags & G_PARAM_EXPLICIT_NOTIFY) ||
+      G_VALUE_TYPE(value1) != G_VALUE_TYPE(value2))
+    return false;
+
+  using ValueEqualFunc = bool (*)(const GValue*, const GValue*);
+  if (auto equal_func = reinterpret_cast<ValueEqualFunc>(
+        g_type_get_qdata(G_VALUE_TYPE(value1), value_equal_func_quark)))
+    return equal_func(value1, value2);
+
+  // Values of custom types (see Glib::Value<T>) without an equality function are
+  // never equal. They are boxed types, and g_param_values_cmp() would compare
+  // only the first pointer-sized part of the GValue's data. With inline storage
+  // that's the first bytes of the value, not a pointer to it.
+  if (G_IS_PARAM_SPEC_BOXED(param_spec))
+    return false;
+
+  return g_param_values_cmp(param_spec, value1, value2) == 0;
+}
+
+// The quark used for storing the number of custom properties of a custom type,
+// which is the expected size of each object's prop_base_vector.
+static const GQuark n_custom_properties_quark =
+  g_quark_from_string("glibmm_CustomObject_n_custom_properties");
+
 custom_properties_type*
 get_obj_custom_props(GObject* obj)
 {
@@ -121,12 +155,65 @@ get_obj_custom_props(GObject* obj)
   if (!obj_custom_props)
   {
     obj_custom_props = new custom_properties_type();
+    obj_custom_props->prop_base_vector.reserve(
+      GPOINTER_TO_UINT(g_type_get_qdata(G_OBJECT_TYPE(obj), n_custom_properties_quark)));
     g_object_set_qdata_full(
       obj, custom_properties_quark, obj_custom_props, destroy_notify_obj_custom_props);
   }
   return obj_custom_props;
 }
 
+// Each object of a custom type looks up the GParamSpecs of its custom
+// properties, which takes a global lock. A small per-thread cache, indexed by
+// the object's type and the property's position in prop_base_vector, keeps
+// the GParamSpecs that were found most recently.
+class CustomPropertyCache
+{
+public:
+  ~CustomPropertyCache()
+  {
+    for (auto& entry : entries_)
+      if (entry.pspec)
+        g_param_spec_unref(entry.pspec);
+  }
+
+  GParamSpec* find(GObject* object, unsigned int position, const char* property_name)
+  {
+    const GType type = G_OBJECT_TYPE(object);
+    Entry& entry = entries_[(type / 4 ^ position * 7) % size];
+
+    if (entry.type == type && entry.position == position &&
+        std::strcmp(entry.pspec->name, property_name) == 0)
+      return entry.pspec;
+
+    GParamSpec* const pspec =
+      g_object_class_find_property(G_OBJECT_GET_CLASS(object), property_name);
+
+    // Names that are not canonical would not pass the check above. Don't cache them.
+    if (pspec && std::strcmp(pspec->name, property_name) == 0)
+    {
+      g_param_spec_ref(pspec);
+      if (entry.pspec)
+        g_param_spec_unref(entry.pspec);
+      entry = { type, position, pspec };
+    }
+    return pspec;
+  }
+
+private:
+  struct Entry
+  {
+    GType type = 0;
+    unsigned int position = 0;
+    GParamSpec* pspec = nullptr;
+  };
+
+  static constexpr std::size_t size = 64;
+  Entry entries_[size];
+};
+
+thread_local CustomPropertyCache custom_property_cache;
+
 } // anonymous namespace
 
 namespace Glib
@@ -246,6 +333,8 @@ glibmm_custom_set_property_callback(
       }
     }
 
+    if (is_unchanged(param_spec, value, (*obj_iface_props)[property_id - 1]))
+      return;
     g_value_copy(value, (*obj_iface_props)[property_id - 1]);
     g_object_notify_by_pspec(object, param_spec);
   }
@@ -261,6 +350,8 @@ glibmm_custom_set_property_callback(
         Glib::PropertyBase* prop_base = (obj_custom_props->prop_base_vector)[index];
         if (prop_base->object_ == wrapper && prop_base->param_spec_ == param_spec)
         {
+          if (is_unchanged(param_spec, value, prop_base->value_.gobj()))
+            return;
           g_value_copy(value, prop_base->value_.gobj());
           g_object_notify_by_pspec(object, param_spec);
         }
@@ -275,7 +366,11 @@ glibmm_custom_set_property_callback(
       // No C++ wrapper exists. Store the value in obj_custom_props->prop_value_map.
       auto it = obj_custom_props->prop_value_map.find(index);
       if (it != obj_custom_props->prop_value_map.end())
+      {
+        if (is_unchanged(param_spec, value, it->second))
+          return;
         g_value_copy(value, it->second);
+      }
       else
       {
         GValue* g_value = g_new0(GValue, 1);
@@ -308,7 +403,10 @@ PropertyBase::lookup_property(const Glib::ustring& name)
 {
   g_assert(param_spec_ == nullptr);
 
-  param_spec_ = g_object_class_find_property(G_OBJECT_GET_CLASS(object_->gobj()), name.c_str());
+  auto obj_custom_props = get_obj_custom_props(object_->gobj());
+  const unsigned int pos_in_obj_custom_props = obj_custom_props->prop_base_vector.size();
+  param_spec_ =
+    custom_property_cache.find(object_->gobj(), pos_in_obj_custom_props, name.c_str());
 
   if (param_spec_)
   {
@@ -317,8 +415,6 @@ PropertyBase::lookup_property(const Glib::ustring& name)
     g_assert(G_PARAM_SPEC_VALUE_TYPE(param_spec_) == G_VALUE_TYPE(value_.gobj()));
     g_param_spec_ref(param_spec_);
 
-    auto obj_custom_props = get_obj_custom_props(object_->gobj());
-    const unsigned int pos_in_obj_custom_props = obj_custom_props->prop_base_vector.size();
     obj_custom_props->prop_base_vector.emplace_back(this);
 
     // If a value has been set by a call to custom_set_property_callback()
@@ -359,6 +455,7 @@ PropertyBase::install_property(GParamSpec* param_spec)
   const unsigned int property_id = pos_in_obj_custom_props + iface_props_size + 1;
 
   g_object_class_install_property(G_OBJECT_GET_CLASS(object_->gobj()), property_id, param_spec);
+  g_type_set_qdata(gtype, n_custom_properties_quark, GUINT_TO_POINTER(pos_in_obj_custom_props + 1));
 
   param_spec_ = param_spec;
   g_param_spec_ref(param_spec_);
@@ -398,4 +495,21 @@ PropertyBase::notify()
   g_object_notify_by_pspec(object_->gobj(), param_spec_);
 }
 
+void
+PropertyBase::set_value_if_changed_(const Glib::ValueBase& value)
+{
+  if (is_unchanged(param_spec_, value.gobj(), value_.gobj()))
+    return;
+
+  g_value_copy(value.gobj(), value_.gobj());
+  notify();
+}
+
+// static
+void
+PropertyBase::set_value_equal_func_(GType value_type, ValueEqualFunc func)
+{
+  g_type_set_qdata(value_type, value_equal_func_quark, reinterpret_cast<void*>(func));
+}
+
 } // namespace Glib
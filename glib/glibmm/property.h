@@ -20,6 +20,9 @@
 #include <glibmmconfig.h>
 #include <glibmm/propertyproxy.h>
 #include <glibmm/value.h>
+#include <tuple>
+#include <type_traits>
+#include <utility>
 
 namespace Glib
 {
@@ -62,6 +65,59 @@ void glibmm_custom_set_property_callback(
 
 #endif /* DOXYGEN_SHOULD_SKIP_THIS */
 
+namespace Traits
+{
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+template <typename T, typename = void>
+struct ElementsHaveEqualityOperator : std::true_type
+{
+};
+#endif
+
+/** Tells if Glib::Property<T> can compare values of a custom type @a T with <tt>operator==</tt>.
+ *
+ * The detection can be wrong for class templates whose <tt>operator==</tt>
+ * exists, but can't be instantiated, such as a container of elements
+ * without <tt>operator==</tt>. Standard containers, <tt>std::pair</tt> and
+ * <tt>std::tuple</tt> are handled. For other such types, specialize this
+ * template to derive from <tt>std::false_type</tt>.
+ *
+ * @newin{2,90}
+ */
+template <typename T, typename = void>
+struct HasEqualityOperator : std::false_type
+{
+};
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+template <typename T>
+struct HasEqualityOperator<T,
+  std::void_t<decltype(std::declval<const T&>() == std::declval<const T&>())>>
+: ElementsHaveEqualityOperator<T>
+{
+};
+
+template <typename T>
+struct ElementsHaveEqualityOperator<T, std::void_t<typename T::value_type>>
+: std::bool_constant<std::is_same<T, typename T::value_type>::value ||
+                     HasEqualityOperator<typename T::value_type>::value>
+{
+};
+
+template <typename T1, typename T2>
+struct ElementsHaveEqualityOperator<std::pair<T1, T2>>
+: std::bool_constant<HasEqualityOperator<T1>::value && HasEqualityOperator<T2>::value>
+{
+};
+
+template <typename... Ts>
+struct ElementsHaveEqualityOperator<std::tuple<Ts...>>
+: std::bool_constant<(HasEqualityOperator<Ts>::value && ...)>
+{
+};
+#endif /* DOXYGEN_SHOULD_SKIP_THIS */
+} // namespace Traits
+
 /** This is the base class for Glib::Object properties.
  *
  * This class manages the generic parts of the object properties.
@@ -122,6 +178,26 @@ protected:
    */
   const char* get_name_internal() const;
 
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+  using ValueEqualFunc = bool (*)(const GValue* value1, const GValue* value2);
+
+  // Returns true if the property was created with ParamFlags::EXPLICIT_NOTIFY.
+  bool notifies_on_change_only_() const
+  { return param_spec_ && (param_spec_->flags & G_PARAM_EXPLICIT_NOTIFY); }
+
+  // Copies value to value_ and notifies, if value differs from value_.
+  void set_value_if_changed_(const Glib::ValueBase& value);
+
+  // Registers the function that compares values of a custom value type.
+  static void set_value_equal_func_(GType value_type, ValueEqualFunc func);
+
+  // Registers operator== of T, if T is a custom type with operator==.
+  // Other types are compared with g_param_values_cmp(), except boxed types,
+  // which are never equal.
+  template <class T>
+  static void register_value_equal_func_();
+#endif /* DOXYGEN_SHOULD_SKIP_THIS */
+
 private:
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
 
@@ -163,6 +239,17 @@ private:
  * (same type, same name) in the same order. One way to achieve this is to
  * declare all properties as direct data members of the type.
  *
+ * If a property is created with Glib::ParamFlags::EXPLICIT_NOTIFY, the
+ * "notify" signal is emitted only when the value changes, both when it's set
+ * with set_value() and with g_object_set_property(). Values are compared with
+ * g_param_values_cmp(). Values of custom types (see Glib::Value<T>) are
+ * compared with <tt>operator==</tt>, if it exists
+ * (see Glib::Traits::HasEqualityOperator). Values of custom types without
+ * <tt>operator==</tt>, and other boxed types, are never equal, i.e. setting
+ * them always emits "notify".
+ * Several changes can be combined into one notification per property with
+ * Glib::NotifyBatch.
+ *
  * You may register new properties for your class (actually for the underlying GType)
  * simply by adding a %Property instance as a class member.
  * However, your constructor must call the Glib::ObjectBase constructor with a new GType name,
@@ -358,6 +445,29 @@ public:
 
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
 
+/**** Glib::PropertyBase ***************************************************/
+
+// static
+template <class T>
+void
+PropertyBase::register_value_equal_func_()
+{
+  // Glib::Value<T> of a custom type is not compatible with _WRAP_PROPERTY.
+  if constexpr (!Traits::ValueCompatibleWithWrapProperty<T>::value &&
+                Traits::HasEqualityOperator<T>::value)
+  {
+    // Register once per type. g_type_set_qdata() takes a global lock.
+    static const bool registered = (set_value_equal_func_(Glib::Value<T>::value_type(),
+      [](const GValue* value1, const GValue* value2) -> bool
+      {
+        // A Glib::Value<T> consists of a GValue.
+        return reinterpret_cast<const Glib::Value<T>*>(value1)->get() ==
+               reinterpret_cast<const Glib::Value<T>*>(value2)->get();
+      }), true);
+    static_cast<void>(registered);
+  }
+}
+
 /**** Glib::Property<T> ****************************************************/
 
 template <class T>
@@ -381,6 +491,9 @@ Property<T>::Property(Glib::Object& object, const Glib::ustring& name,
 {
   flags |= Glib::ParamFlags::READWRITE;
 
+  if ((flags & Glib::ParamFlags::EXPLICIT_NOTIFY) == Glib::ParamFlags::EXPLICIT_NOTIFY)
+    register_value_equal_func_<T>();
+
   if (!lookup_property(name))
     install_property(static_cast<ValueType&>(value_).create_param_spec(name, nick, blurb, flags));
 }
@@ -393,6 +506,9 @@ Property<T>::Property(Glib::Object& object, const Glib::ustring& name, const Pro
 {
   flags |= Glib::ParamFlags::READWRITE;
 
+  if ((flags & Glib::ParamFlags::EXPLICIT_NOTIFY) == Glib::ParamFlags::EXPLICIT_NOTIFY)
+    register_value_equal_func_<T>();
+
   static_cast<ValueType&>(value_).set(default_value);
 
   if (!lookup_property(name))
@@ -403,6 +519,15 @@ template <class T>
 inline void
 Property<T>::set_value(const typename Property<T>::PropertyType& data)
 {
+  if (notifies_on_change_only_())
+  {
+    ValueType value;
+    value.init(ValueType::value_type());
+    value.set(data);
+    set_value_if_changed_(value);
+    return;
+  }
+
   static_cast<ValueType&>(value_).set(data);
   this->notify();
 }
@@ -418,8 +543,7 @@ template <class T>
 inline Property<T>&
 Property<T>::operator=(const typename Property<T>::PropertyType& data)
 {
-  static_cast<ValueType&>(value_).set(data);
-  this->notify();
+  set_value(data);
   return *this;
 }
 
@@ -144,13 +144,23 @@ PropertyProxy_Base::signal_changed()
 void
 PropertyProxy_Base::set_property_(const Glib::ValueBase& value)
 {
-  g_object_set_property(obj_->gobj(), property_name_, value.gobj());
+  // A PropertyProxy_Base is created for each access to a property_*() accessor,
+  // so it can't keep the GParamSpec itself.
+  if (const GParamSpec* const pParamSpec =
+        PropertyIdBase::find_cached(G_OBJECT_TYPE(obj_->gobj()), property_name_))
+    obj_->set_property_value(pParamSpec, value);
+  else
+    g_object_set_property(obj_->gobj(), property_name_, value.gobj()); // Reports the error.
 }
 
 void
 PropertyProxy_Base::get_property_(Glib::ValueBase& value) const
 {
-  g_object_get_property(obj_->gobj(), property_name_, value.gobj());
+  if (const GParamSpec* const pParamSpec =
+        PropertyIdBase::find_cached(G_OBJECT_TYPE(obj_->gobj()), property_name_))
+    obj_->get_property_value(pParamSpec, value);
+  else
+    g_object_get_property(obj_->gobj(), property_name_, value.gobj()); // Reports the error.
 }
 
 void
@@ -158,7 +168,7 @@ PropertyProxy_Base::reset_property_()
 {
   // Get information about the parameter:
   const GParamSpec* const pParamSpec =
-    g_object_class_find_property(G_OBJECT_GET_CLASS(obj_->gobj()), property_name_);
+    PropertyIdBase::find_cached(G_OBJECT_TYPE(obj_->gobj()), property_name_);
 
   g_return_if_fail(pParamSpec != nullptr);
 
@@ -169,7 +179,7 @@ PropertyProxy_Base::reset_property_()
   // has already initialized it to the default value for this type.
   // value.reset();
 
-  g_object_set_property(obj_->gobj(), property_name_, value.gobj());
+  obj_->set_property_value(pParamSpec, value);
 }
 
 } // namespace Glib
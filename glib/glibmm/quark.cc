@@ -17,6 +17,28 @@
  */
 
 #include <glibmm/quark.h>
+#include <cstring>
+
+namespace
+{
+
+// Calls func with a nul-terminated copy of s. Short strings are copied
+// to the stack, longer ones to a std::string.
+template <typename Func>
+GQuark
+with_c_string(std::string_view s, Func func)
+{
+  char buffer[128];
+  if (s.size() < sizeof(buffer))
+  {
+    std::memcpy(buffer, s.data(), s.size());
+    buffer[s.size()] = '\0';
+    return func(buffer);
+  }
+  return func(std::string(s).c_str());
+}
+
+} // anonymous namespace
 
 namespace Glib
 {
@@ -33,6 +55,14 @@ QueryQuark::QueryQuark(const char* s) : quark_(g_quark_try_string(s))
 {
 }
 
+QueryQuark::QueryQuark(const std::string& s) : quark_(g_quark_try_string(s.c_str()))
+{
+}
+
+QueryQuark::QueryQuark(std::string_view s) : quark_(with_c_string(s, &g_quark_try_string))
+{
+}
+
 QueryQuark&
 QueryQuark::operator=(const QueryQuark& q)
 {
@@ -53,6 +83,14 @@ Quark::Quark(const char* s) : QueryQuark(g_quark_from_string(s))
 {
 }
 
+Quark::Quark(const std::string& s) : QueryQuark(g_quark_from_string(s.c_str()))
+{
+}
+
+Quark::Quark(std::string_view s) : QueryQuark(with_c_string(s, &g_quark_from_string))
+{
+}
+
 Quark::~Quark() noexcept
 {
 }
@@ -22,6 +22,8 @@
 #include <glibmmconfig.h>
 #include <glibmm/ustring.h>
 #include <glib.h>
+#include <string>
+#include <string_view>
 
 namespace Glib
 {
@@ -38,6 +40,10 @@ namespace Glib
  * ie.
  *   void set_data (const Quark&, void * data);
  *   void* get_data (const QueryQuark&);
+ *
+ * Creating a Quark or a QueryQuark looks up the string in a global hash
+ * table, protected by a lock. For fixed strings in frequently executed code,
+ * use static_quark() or GLIBMM_STATIC_QUARK(), which do the lookup once.
  */
 class GLIBMM_API QueryQuark
 {
@@ -45,6 +51,10 @@ public:
   QueryQuark(const GQuark& q);
   QueryQuark(const ustring& s);
   QueryQuark(const char* s);
+  /// @newin{2,90}
+  QueryQuark(const std::string& s);
+  /// @newin{2,90}
+  QueryQuark(std::string_view s);
   ~QueryQuark() noexcept {}
   QueryQuark& operator=(const QueryQuark& q);
   operator ustring() const;
@@ -61,9 +71,50 @@ class GLIBMM_API Quark : public QueryQuark
 public:
   Quark(const ustring& s);
   Quark(const char* s);
+  /// @newin{2,90}
+  Quark(const std::string& s);
+  /// @newin{2,90}
+  Quark(std::string_view s);
   ~Quark() noexcept;
 };
 
+/** Gets the quark of a string that is known at compile time.
+ *
+ * The string is interned the first time static_quark() is called for it.
+ * Later calls only check that the function-local static variable has been
+ * initialized, without the lock and the hash table lookup of Quark.
+ *
+ * C++17 doesn't accept string literals as template arguments. The string must
+ * be a named array with static storage duration:
+ * @code
+ * static constexpr char selection_key[] = "myapp-selection";
+ * object->set_data(Glib::static_quark<selection_key>(), data);
+ * @endcode
+ * For a string literal, use GLIBMM_STATIC_QUARK().
+ *
+ * @newin{2,90}
+ */
+template <const char* name>
+inline const Quark&
+static_quark()
+{
+  static const Quark quark(name);
+  return quark;
+}
+
+/** Gets the quark of a string literal. Like Glib::static_quark(), the string is
+ * interned only the first time the expression is evaluated at this place in the code.
+ * @code
+ * object->set_data(GLIBMM_STATIC_QUARK("myapp-selection"), data);
+ * @endcode
+ * The result is a <tt>const Glib::Quark&</tt>.
+ *
+ * @newin{2,90}
+ */
+#define GLIBMM_STATIC_QUARK(literal) \
+  ([]() -> const ::Glib::Quark& { static const ::Glib::Quark glibmm_static_quark_(literal); \
+                                  return glibmm_static_quark_; }())
+
 /** @relates Glib::QueryQuark */
 inline bool
 operator==(const QueryQuark& a, const QueryQuark& b)
@@ -18,6 +18,27 @@
 
 #include <glibmm.h>
 
+namespace
+{
+
+guint64
+random_guint64()
+{
+  return (guint64(g_random_int()) << 32) | g_random_int();
+}
+
+// Expands a 64-bit seed, as recommended by the authors of xoshiro256**.
+guint64
+splitmix64(guint64& x)
+{
+  guint64 z = (x += G_GUINT64_CONSTANT(0x9e3779b97f4a7c15));
+  z = (z ^ (z >> 30)) * G_GUINT64_CONSTANT(0xbf58476d1ce4e5b9);
+  z = (z ^ (z >> 27)) * G_GUINT64_CONSTANT(0x94d049bb133111eb);
+  return z ^ (z >> 31);
+}
+
+} // anonymous namespace
+
 namespace Glib
 {
 
@@ -70,4 +91,147 @@ Rand::get_double_range(double begin, double end)
   return g_rand_double_range(gobject_, begin, end);
 }
 
+void
+Rand::fill(guint32* buffer, std::size_t n)
+{
+  for (std::size_t i = 0; i < n; ++i)
+    buffer[i] = g_rand_int(gobject_);
+}
+
+void
+Rand::fill(double* buffer, std::size_t n)
+{
+  for (std::size_t i = 0; i < n; ++i)
+    buffer[i] = g_rand_double(gobject_);
+}
+
+/**** Glib::Xoshiro256 *****************************************************/
+
+Xoshiro256::Xoshiro256()
+{
+  set_seed(random_guint64());
+}
+
+Xoshiro256::Xoshiro256(guint64 seed)
+{
+  set_seed(seed);
+}
+
+void
+Xoshiro256::set_seed(guint64 seed)
+{
+  // splitmix64 never gives four zeros, the only invalid state.
+  for (auto& s : s_)
+    s = splitmix64(seed);
+}
+
+// The fill() methods work on a local copy of the state, which the compiler
+// can keep in registers.
+
+void
+Xoshiro256::fill(guint64* buffer, std::size_t n)
+{
+  Xoshiro256 generator(*this);
+  for (std::size_t i = 0; i < n; ++i)
+    buffer[i] = generator();
+  *this = generator;
+}
+
+void
+Xoshiro256::fill(guint32* buffer, std::size_t n)
+{
+  Xoshiro256 generator(*this);
+  for (std::size_t i = 0; i < n; ++i)
+    buffer[i] = generator.get_int();
+  *this = generator;
+}
+
+void
+Xoshiro256::fill(double* buffer, std::size_t n)
+{
+  Xoshiro256 generator(*this);
+  for (std::size_t i = 0; i < n; ++i)
+    buffer[i] = generator.get_double();
+  *this = generator;
+}
+
+void
+Xoshiro256::jump()
+{
+  static const guint64 jump_polynomial[] = {
+    G_GUINT64_CONSTANT(0x180ec6d33cfd0aba), G_GUINT64_CONSTANT(0xd5a61266f0c9392c),
+    G_GUINT64_CONSTANT(0xa9582618e03fc9aa), G_GUINT64_CONSTANT(0x39abdc4529b1661c)
+  };
+
+  guint64 s[4] = { 0, 0, 0, 0 };
+  for (const guint64 word : jump_polynomial)
+    for (int bit = 0; bit < 64; ++bit)
+    {
+      if (word & (G_GUINT64_CONSTANT(1) << bit))
+        for (int i = 0; i < 4; ++i)
+          s[i] ^= s_[i];
+      (*this)();
+    }
+
+  for (int i = 0; i < 4; ++i)
+    s_[i] = s[i];
+}
+
+// static
+Xoshiro256&
+Xoshiro256::get_thread_default()
+{
+  static thread_local Xoshiro256 generator;
+  return generator;
+}
+
+/**** Glib::Pcg32 **********************************************************/
+
+Pcg32::Pcg32()
+{
+  set_seed(random_guint64(), random_guint64());
+}
+
+Pcg32::Pcg32(guint64 seed, guint64 stream)
+{
+  set_seed(seed, stream);
+}
+
+void
+Pcg32::set_seed(guint64 seed, guint64 stream)
+{
+  // As pcg32_srandom_r() in the reference implementation.
+  state_ = 0;
+  increment_ = (stream << 1) | 1;
+  (*this)();
+  state_ += seed;
+  (*this)();
+}
+
+void
+Pcg32::fill(guint32* buffer, std::size_t n)
+{
+  Pcg32 generator(*this);
+  for (std::size_t i = 0; i < n; ++i)
+    buffer[i] = generator();
+  *this = generator;
+}
+
+void
+Pcg32::fill(double* buffer, std::size_t n)
+{
+  Pcg32 generator(*this);
+  for (std::size_t i = 0; i < n; ++i)
+    buffer[i] = generator.get_double();
+  *this = generator;
+}
+
+// static
+Pcg32&
+Pcg32::get_thread_default()
+{
+  static thread_local Pcg32 generator;
+  return generator;
+}
+
 } // namespace Glib
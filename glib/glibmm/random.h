@@ -21,6 +21,8 @@
 
 #include <glibmmconfig.h>
 #include <glib.h>
+#include <cstddef>
+#include <iterator>
 
 extern "C" {
 using GRand = struct _GRand;
@@ -30,13 +32,34 @@ namespace Glib
 {
 
 /** @defgroup Random Random Numbers
- * Pseudo random number generator.
+ * Pseudo random number generators.
+ *
+ * Rand wraps GLib's GRand, a Mersenne Twister. Xoshiro256 and Pcg32 are
+ * much faster generators with a small state, whose functions are inline.
+ * They are good choices for simulations and for generating test data, but
+ * like Rand they are not suitable for cryptography.
+ *
+ * All generators satisfy the UniformRandomBitGenerator requirements, so they
+ * can be used with the distributions in the <tt>\<random></tt> header:
+ * @code
+ * std::normal_distribution<double> normal(0.0, 1.0);
+ * const double x = normal(Glib::Xoshiro256::get_thread_default());
+ * @endcode
+ *
+ * The fill() methods generate many numbers in one call. Those of Xoshiro256
+ * and Pcg32 generate them inline, without a function call per number.
+ * Rand::fill() still calls g_rand_int() or g_rand_double() for each number.
  * @{
  */
 
+/** A wrapper of GLib's GRand, a Mersenne Twister.
+ */
 class GLIBMM_API Rand
 {
 public:
+  /// The type of the numbers returned by operator()().
+  using result_type = guint32;
+
   Rand();
   explicit Rand(guint32 seed);
   ~Rand() noexcept;
@@ -55,6 +78,30 @@ public:
   double get_double();
   double get_double_range(double begin, double end);
 
+  /** Fills a buffer with random integers, as returned by get_int().
+   * @newin{2,90}
+   */
+  void fill(guint32* buffer, std::size_t n);
+
+  /** Fills a buffer with random doubles in the range [0, 1), as returned by get_double().
+   * @newin{2,90}
+   */
+  void fill(double* buffer, std::size_t n);
+
+  /** Fills a contiguous container, such as a std::vector or a std::array,
+   * of guint32 or double.
+   * @newin{2,90}
+   */
+  template <class Container>
+  void fill(Container& container) { fill(std::data(container), std::size(container)); }
+
+  /// The smallest value returned by operator()(). @newin{2,90}
+  static constexpr result_type min() { return 0; }
+  /// The largest value returned by operator()(). @newin{2,90}
+  static constexpr result_type max() { return G_MAXUINT32; }
+  /// Same as get_int(). @newin{2,90}
+  result_type operator()() { return get_int(); }
+
   GRand* gobj() { return gobject_; }
   const GRand* gobj() const { return gobject_; }
 
@@ -62,6 +109,178 @@ private:
   GRand* gobject_;
 };
 
+/** The xoshiro256** generator by David Blackman and Sebastiano Vigna.
+ *
+ * It generates 64-bit numbers, has a period of 2<sup>256</sup> - 1 and
+ * a state of 32 bytes. jump() gives non-overlapping sequences, e.g.
+ * for parallel computations.
+ *
+ * A %Xoshiro256 must not be used by several threads at the same time.
+ * get_thread_default() returns an instance per thread.
+ *
+ * @newin{2,90}
+ */
+class GLIBMM_API Xoshiro256
+{
+public:
+  /// The type of the numbers returned by operator()().
+  using result_type = guint64;
+
+  /// Creates a generator with a random seed.
+  Xoshiro256();
+
+  /** Creates a generator with a fixed seed.
+   * Equal seeds give equal sequences.
+   */
+  explicit Xoshiro256(guint64 seed);
+
+  void set_seed(guint64 seed);
+
+  static constexpr result_type min() { return 0; }
+  static constexpr result_type max() { return G_MAXUINT64; }
+
+  /// Returns a random integer in the range [0, 2<sup>64</sup>).
+  inline result_type operator()();
+
+  /// Returns a random integer in the range [0, 2<sup>32</sup>).
+  guint32 get_int() { return static_cast<guint32>((*this)() >> 32); }
+
+  /// Returns a random double in the range [0, 1).
+  double get_double() { return to_double((*this)()); }
+
+  /// Returns a random double in the range [@a begin, @a end).
+  double get_double_range(double begin, double end)
+  { return begin + get_double() * (end - begin); }
+
+  /// Fills a buffer with random integers, as returned by operator()().
+  void fill(guint64* buffer, std::size_t n);
+  /// Fills a buffer with random integers, as returned by get_int().
+  void fill(guint32* buffer, std::size_t n);
+  /// Fills a buffer with random doubles, as returned by get_double().
+  void fill(double* buffer, std::size_t n);
+
+  /** Fills a contiguous container, such as a std::vector or a std::array,
+   * of guint64, guint32 or double.
+   */
+  template <class Container>
+  void fill(Container& container) { fill(std::data(container), std::size(container)); }
+
+  /** Advances the generator by 2<sup>128</sup> numbers.
+   *
+   * Copies of a generator, each jumped a different number of times,
+   * give 2<sup>128</sup> non-overlapping numbers each.
+   */
+  void jump();
+
+  /** Returns a generator that is used only by the calling thread.
+   *
+   * It is created with a random seed at the first call in each thread.
+   */
+  static Xoshiro256& get_thread_default();
+
+private:
+  static guint64 rotl(guint64 x, int k) { return (x << k) | (x >> (64 - k)); }
+  static double to_double(guint64 x) { return (x >> 11) * 0x1.0p-53; }
+
+  guint64 s_[4];
+};
+
+inline Xoshiro256::result_type
+Xoshiro256::operator()()
+{
+  const guint64 result = rotl(s_[1] * 5, 7) * 9;
+  const guint64 t = s_[1] << 17;
+
+  s_[2] ^= s_[0];
+  s_[3] ^= s_[1];
+  s_[1] ^= s_[2];
+  s_[0] ^= s_[3];
+  s_[2] ^= t;
+  s_[3] = rotl(s_[3], 45);
+
+  return result;
+}
+
+/** The PCG32 generator (XSH RR) by Melissa O'Neill.
+ *
+ * It generates 32-bit numbers, has a period of 2<sup>64</sup> and a state
+ * of 16 bytes. Generators with different stream numbers give different
+ * sequences, even with the same seed.
+ *
+ * A %Pcg32 must not be used by several threads at the same time.
+ * get_thread_default() returns an instance per thread.
+ *
+ * @newin{2,90}
+ */
+class GLIBMM_API Pcg32
+{
+public:
+  /// The type of the numbers returned by operator()().
+  using result_type = guint32;
+
+  /// Creates a generator with a random seed and stream.
+  Pcg32();
+
+  /** Creates a generator with a fixed seed.
+   * Equal seeds and streams give equal sequences.
+   */
+  explicit Pcg32(guint64 seed, guint64 stream = 0);
+
+  void set_seed(guint64 seed, guint64 stream = 0);
+
+  static constexpr result_type min() { return 0; }
+  static constexpr result_type max() { return G_MAXUINT32; }
+
+  /// Returns a random integer in the range [0, 2<sup>32</sup>).
+  inline result_type operator()();
+
+  /// Same as operator()().
+  guint32 get_int() { return (*this)(); }
+
+  /// Returns a random double in the range [0, 1).
+  double get_double()
+  {
+    const guint64 high = (*this)() >> 5;
+    const guint64 low = (*this)() >> 6;
+    return ((high << 26) | low) * 0x1.0p-53;
+  }
+
+  /// Returns a random double in the range [@a begin, @a end).
+  double get_double_range(double begin, double end)
+  { return begin + get_double() * (end - begin); }
+
+  /// Fills a buffer with random integers, as returned by operator()().
+  void fill(guint32* buffer, std::size_t n);
+  /// Fills a buffer with random doubles, as returned by get_double().
+  void fill(double* buffer, std::size_t n);
+
+  /** Fills a contiguous container, such as a std::vector or a std::array,
+   * of guint32 or double.
+   */
+  template <class Container>
+  void fill(Container& container) { fill(std::data(container), std::size(container)); }
+
+  /** Returns a generator that is used only by the calling thread.
+   *
+   * It is created with a random seed and stream at the first call in each thread.
+   */
+  static Pcg32& get_thread_default();
+
+private:
+  guint64 state_ = 0;
+  guint64 increment_ = 1;
+};
+
+inline Pcg32::result_type
+Pcg32::operator()()
+{
+  const guint64 old_state = state_;
+  state_ = old_state * G_GUINT64_CONSTANT(6364136223846793005) + increment_;
+  const guint32 xorshifted = static_cast<guint32>(((old_state >> 18) ^ old_state) >> 27);
+  const guint32 rotation = static_cast<guint32>(old_state >> 59);
+  return (xorshifted >> rotation) | (xorshifted << ((32 - rotation) & 31));
+}
+
 /** @} group Random */
 
 } // namespace Glib
@@ -0,0 +1,80 @@
+#ifndef _GLIBMM_STOPWATCH_H
+#define _GLIBMM_STOPWATCH_H
+
+/* Copyright (C) 2026 The glibmm Development Team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <glibmmconfig.h>
+#include <glib.h>
+#include <chrono>
+
+namespace Glib
+{
+
+/** A monotonic stop watch with nanosecond resolution.
+ *
+ * Unlike Glib::Timer, %StopWatch allocates nothing and all its methods are
+ * inline. It reads the monotonic clock (@c std::chrono::steady_clock,
+ * which is @c clock_gettime(CLOCK_MONOTONIC) on Linux), so it can be used
+ * in hot code paths. See also ScopeTimer.
+ *
+ * A %StopWatch is always running. start() sets it to zero.
+ *
+ * @newin{2,90}
+ */
+class StopWatch
+{
+public:
+  /// Creates a stop watch and starts it.
+  StopWatch() noexcept : start_ns_(now_ns()) {}
+
+  /// Restarts the stop watch.
+  void start() noexcept { start_ns_ = now_ns(); }
+
+  /// Gets the time since the last start() in nanoseconds.
+  gint64 elapsed_ns() const noexcept { return now_ns() - start_ns_; }
+
+  /// Gets the time since the last start() in microseconds.
+  gint64 elapsed_usec() const noexcept { return elapsed_ns() / 1000; }
+
+  /// Gets the time since the last start() in seconds.
+  double elapsed() const noexcept { return elapsed_ns() * 1.0e-9; }
+
+  /** Gets the time since the last start() in nanoseconds, and restarts.
+   * Only one clock reading is needed for both.
+   */
+  gint64 lap_ns() noexcept
+  {
+    const gint64 now = now_ns();
+    const gint64 elapsed = now - start_ns_;
+    start_ns_ = now;
+    return elapsed;
+  }
+
+  /// Reads the monotonic clock, in nanoseconds since an unspecified point in time.
+  static gint64 now_ns() noexcept
+  {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::steady_clock::now().time_since_epoch()).count();
+  }
+
+private:
+  gint64 start_ns_;
+};
+
+} // namespace Glib
+
+#endif /* _GLIBMM_STOPWATCH_H */
@@ -0,0 +1,88 @@
+/* Copyright (C) 2026 The glibmm Development Team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <glibmm/strvview.h>
+#include <glib.h>
+
+namespace Glib
+{
+
+StrvView::StrvView(char** strv) noexcept
+: strv_(strv), size_(strv ? g_strv_length(strv) : 0)
+{
+}
+
+StrvView::StrvView(char** strv, size_type size) noexcept
+: strv_(strv), size_(strv ? size : 0)
+{
+}
+
+StrvView::StrvView(StrvView&& src) noexcept
+: strv_(src.strv_), size_(src.size_)
+{
+  src.strv_ = nullptr;
+  src.size_ = 0;
+}
+
+StrvView&
+StrvView::operator=(StrvView&& src) noexcept
+{
+  if (&src != this)
+  {
+    g_strfreev(strv_);
+    strv_ = src.strv_;
+    size_ = src.size_;
+    src.strv_ = nullptr;
+    src.size_ = 0;
+  }
+  return *this;
+}
+
+StrvView::~StrvView() noexcept
+{
+  g_strfreev(strv_);
+}
+
+char**
+StrvView::release() noexcept
+{
+  char** const strv = strv_;
+  strv_ = nullptr;
+  size_ = 0;
+  return strv;
+}
+
+std::vector<Glib::ustring>
+StrvView::to_ustring_vector() const
+{
+  std::vector<Glib::ustring> vector;
+  vector.reserve(size_);
+  for (size_type i = 0; i < size_; ++i)
+    vector.emplace_back(strv_[i]);
+  return vector;
+}
+
+std::vector<std::string>
+StrvView::to_string_vector() const
+{
+  std::vector<std::string> vector;
+  vector.reserve(size_);
+  for (size_type i = 0; i < size_; ++i)
+    vector.emplace_back(strv_[i]);
+  return vector;
+}
+
+} // namespace Glib
@@ -0,0 +1,154 @@
+#ifndef _GLIBMM_STRVVIEW_H
+#define _GLIBMM_STRVVIEW_H
+
+/* Copyright (C) 2026 The glibmm Development Team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <glibmmconfig.h>
+#include <glibmm/ustring.h>
+#include <cstddef>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Glib
+{
+
+/** A read-only view of an owned, 0-terminated array of strings.
+ *
+ * Many GLib functions return a newly allocated <tt>gchar**</tt>, which is
+ * freed with g_strfreev(). Functions that return a std::vector<Glib::ustring>
+ * copy each string and then free the original. %StrvView instead takes
+ * ownership of the array and gives access to the strings where they are,
+ * as std::string_view or as <tt>const char*</tt>. The array is freed when
+ * the view is destroyed.
+ *
+ * @code
+ * for (std::string_view group : key_file.get_groups_view())
+ *   if (group.substr(0, 7) == "Desktop")
+ *     ++n_desktop_groups;
+ * @endcode
+ *
+ * The string views are valid as long as the %StrvView exists. A %StrvView
+ * can be moved, but not copied. It can be converted to a
+ * std::vector<Glib::ustring>, which copies the strings.
+ *
+ * @newin{2,90}
+ */
+class GLIBMM_API StrvView
+{
+public:
+  class const_iterator
+  {
+  public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = std::string_view;
+    using difference_type = std::ptrdiff_t;
+    using reference = value_type;
+    using pointer = void;
+
+    const_iterator() = default;
+    explicit const_iterator(char* const* pos) : pos_(pos) {}
+
+    value_type operator*() const { return *pos_; }
+    value_type operator[](difference_type offset) const { return pos_[offset]; }
+
+    const_iterator& operator++() { ++pos_; return *this; }
+    const_iterator operator++(int) { return const_iterator(pos_++); }
+    const_iterator& operator--() { --pos_; return *this; }
+    const_iterator operator--(int) { return const_iterator(pos_--); }
+    const_iterator& operator+=(difference_type rhs) { pos_ += rhs; return *this; }
+    const_iterator& operator-=(difference_type rhs) { pos_ -= rhs; return *this; }
+    const_iterator operator+(difference_type rhs) const { return const_iterator(pos_ + rhs); }
+    const_iterator operator-(difference_type rhs) const { return const_iterator(pos_ - rhs); }
+    difference_type operator-(const const_iterator& rhs) const { return pos_ - rhs.pos_; }
+
+    bool operator==(const const_iterator& rhs) const { return pos_ == rhs.pos_; }
+    bool operator!=(const const_iterator& rhs) const { return pos_ != rhs.pos_; }
+    bool operator<(const const_iterator& rhs) const { return pos_ < rhs.pos_; }
+    bool operator>(const const_iterator& rhs) const { return pos_ > rhs.pos_; }
+    bool operator<=(const const_iterator& rhs) const { return pos_ <= rhs.pos_; }
+    bool operator>=(const const_iterator& rhs) const { return pos_ >= rhs.pos_; }
+
+  private:
+    char* const* pos_ = nullptr;
+  };
+
+  using value_type = std::string_view;
+  using size_type = std::size_t;
+  using iterator = const_iterator;
+
+  /// Constructs an empty view.
+  StrvView() noexcept = default;
+
+  /** Constructs a view that takes ownership of @a strv.
+   * @param strv A 0-terminated array of strings, which will be freed with
+   *        g_strfreev(). May be <tt>nullptr</tt>.
+   */
+  explicit StrvView(char** strv) noexcept;
+
+  /** Constructs a view that takes ownership of @a strv, whose length is known.
+   * @param strv A 0-terminated array of strings, which will be freed with
+   *        g_strfreev(). May be <tt>nullptr</tt>.
+   * @param size The number of strings in @a strv.
+   */
+  StrvView(char** strv, size_type size) noexcept;
+
+  StrvView(StrvView&& src) noexcept;
+  StrvView& operator=(StrvView&& src) noexcept;
+  ~StrvView() noexcept;
+
+  // noncopyable
+  StrvView(const StrvView&) = delete;
+  StrvView& operator=(const StrvView&) = delete;
+
+  const_iterator begin() const { return const_iterator(strv_); }
+  const_iterator end() const { return const_iterator(strv_ + size_); }
+  size_type size() const { return size_; }
+  bool empty() const { return size_ == 0; }
+
+  value_type operator[](size_type index) const { return strv_[index]; }
+  /// The view must not be empty.
+  value_type front() const { return *strv_; }
+
+  /// Gets the string at @a index as a 0-terminated C string.
+  const char* c_str(size_type index) const { return strv_[index]; }
+
+  /// Gets the array. It is owned by the view. May be <tt>nullptr</tt>.
+  const char* const* data() const { return strv_; }
+
+  /** Gives up ownership of the array.
+   * @return The array, which must be freed with g_strfreev(). The view is empty.
+   */
+  char** release() noexcept;
+
+  /// Copies the strings.
+  std::vector<Glib::ustring> to_ustring_vector() const;
+  /// Copies the strings.
+  std::vector<std::string> to_string_vector() const;
+
+  /// Copies the strings.
+  operator std::vector<Glib::ustring>() const { return to_ustring_vector(); }
+
+private:
+  char** strv_ = nullptr;
+  size_type size_ = 0;
+};
+
+} // namespace Glib
+
+#endif /* _GLIBMM_STRVVIEW_H */
@@ -0,0 +1,193 @@
+/* Copyright (C) 2026 The glibmm Development Team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <glibmm/threadpool.h>
+#include <glibmm/exceptionhandler.h>
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Glib
+{
+
+struct ThreadPool::Impl
+{
+  struct Worker
+  {
+    std::mutex mutex;
+    std::deque<std::unique_ptr<Task>> tasks;
+    std::thread thread;
+  };
+
+  explicit Impl(unsigned int n_threads);
+
+  void worker_main(unsigned int index);
+  std::unique_ptr<Task> pop_task(unsigned int index);
+
+  std::vector<std::unique_ptr<Worker>> workers;
+
+  // Workers without tasks sleep on sleep_cond.
+  // n_queued is incremented while sleep_mutex is locked, so a notification
+  // can't be lost between a worker's check and its wait.
+  std::mutex sleep_mutex;
+  std::condition_variable sleep_cond;
+  std::atomic<long> n_queued{ 0 };
+  bool stopping = false;
+
+  // Round-robin index for tasks submitted from outside the pool.
+  std::atomic<unsigned int> next_worker{ 0 };
+};
+
+namespace
+{
+// The pool and worker index of the current thread, if it's a worker thread.
+thread_local const void* current_pool = nullptr;
+thread_local unsigned int current_worker = 0;
+} // anonymous namespace
+
+ThreadPool::Impl::Impl(unsigned int n_threads)
+{
+  if (n_threads == 0)
+    n_threads = std::max(1u, std::thread::hardware_concurrency());
+
+  workers.reserve(n_threads);
+  for (unsigned int i = 0; i < n_threads; ++i)
+    workers.emplace_back(std::make_unique<Worker>());
+
+  // Start the threads when all workers exist. They steal from each other.
+  for (unsigned int i = 0; i < n_threads; ++i)
+    workers[i]->thread = std::thread(&Impl::worker_main, this, i);
+}
+
+std::unique_ptr<ThreadPool::Task>
+ThreadPool::Impl::pop_task(unsigned int index)
+{
+  // The most recently added task from the own queue.
+  {
+    Worker& worker = *workers[index];
+    std::lock_guard<std::mutex> lock(worker.mutex);
+    if (!worker.tasks.empty())
+    {
+      auto task = std::move(worker.tasks.back());
+      worker.tasks.pop_back();
+      return task;
+    }
+  }
+
+  // The oldest task from another worker's queue.
+  const auto n_workers = workers.size();
+  for (std::size_t i = 1; i < n_workers; ++i)
+  {
+    Worker& victim = *workers[(index + i) % n_workers];
+    std::lock_guard<std::mutex> lock(victim.mutex);
+    if (!victim.tasks.empty())
+    {
+      auto task = std::move(victim.tasks.front());
+      victim.tasks.pop_front();
+      return task;
+    }
+  }
+
+  return {};
+}
+
+void
+ThreadPool::Impl::worker_main(unsigned int index)
+{
+  current_pool = this;
+  current_worker = index;
+
+  for (;;)
+  {
+    if (auto task = pop_task(index))
+    {
+      --n_queued;
+      try
+      {
+        task->run();
+      }
+      catch (...)
+      {
+        // Exceptions from the task itself are stored in its future.
+        // This catches exceptions from cancellation checks and MainContext::invoke().
+        Glib::exception_handlers_invoke();
+      }
+      continue;
+    }
+
+    std::unique_lock<std::mutex> lock(sleep_mutex);
+    sleep_cond.wait(lock, [this]() { return stopping || n_queued > 0; });
+    if (stopping && n_queued <= 0)
+      break;
+  }
+}
+
+ThreadPool::Task::~Task() noexcept
+{
+}
+
+ThreadPool::ThreadPool(unsigned int n_threads) : impl_(std::make_unique<Impl>(n_threads))
+{
+}
+
+ThreadPool::~ThreadPool() noexcept
+{
+  {
+    std::lock_guard<std::mutex> lock(impl_->sleep_mutex);
+    impl_->stopping = true;
+  }
+  impl_->sleep_cond.notify_all();
+
+  for (auto& worker : impl_->workers)
+    worker->thread.join();
+}
+
+unsigned int
+ThreadPool::get_n_threads() const
+{
+  return impl_->workers.size();
+}
+
+unsigned int
+ThreadPool::get_n_queued() const
+{
+  const long n_queued = impl_->n_queued;
+  return n_queued > 0 ? n_queued : 0;
+}
+
+void
+ThreadPool::push(std::unique_ptr<Task> task)
+{
+  const unsigned int index = (current_pool == impl_.get())
+                               ? current_worker
+                               : impl_->next_worker++ % impl_->workers.size();
+  {
+    auto& worker = *impl_->workers[index];
+    std::lock_guard<std::mutex> lock(worker.mutex);
+    worker.tasks.emplace_back(std::move(task));
+  }
+  {
+    std::lock_guard<std::mutex> lock(impl_->sleep_mutex);
+    ++impl_->n_queued;
+  }
+  impl_->sleep_cond.notify_one();
+}
+
+} // namespace Glib
@@ -0,0 +1,239 @@
+#ifndef _GLIBMM_THREADPOOL_H
+#define _GLIBMM_THREADPOOL_H
+
+/* Copyright (C) 2026 The glibmm Development Team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <glibmmconfig.h>
+#include <glibmm/main.h>
+#include <glibmm/priorities.h>
+#include <glibmm/refptr.h>
+#include <sigc++/sigc++.h>
+#include <future>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace Glib
+{
+
+/** A pool of worker threads that execute tasks.
+ *
+ * Each worker thread has its own task queue. Tasks submitted from outside the
+ * pool are distributed round-robin over the queues. Tasks submitted from a
+ * task that runs in a worker thread are added to that worker's queue.
+ * A worker takes the most recently added task from its own queue. When its
+ * queue is empty, it steals the oldest task from another worker's queue.
+ * This keeps related tasks on the same thread and balances the load without
+ * a central queue that all threads contend for.
+ *
+ * submit() returns a <tt>std::future</tt>. Another overload of submit()
+ * delivers the result to a slot that is invoked in a MainContext, usually
+ * the context of the thread that submitted the task. That's a simple way
+ * to offload CPU-heavy work from a thread that runs a main loop:
+ * @code
+ * Glib::ThreadPool pool;
+ * pool.submit([]() { return compute_checksum(data); },
+ *   [](std::future<std::string>& result) { label.set_text(result.get()); },
+ *   Glib::MainContext::get_default());
+ * @endcode
+ *
+ * A task can be cancelled before it starts, if a cancellation check is
+ * supplied. The check is called in the worker thread immediately before the
+ * task would run. With a Gio::Cancellable:
+ * @code
+ * pool.submit(work, [cancellable]() { return cancellable->is_cancelled(); });
+ * @endcode
+ * The future of a cancelled task throws <tt>std::future_error</tt> with code
+ * <tt>std::future_errc::broken_promise</tt>.
+ *
+ * The public methods of %ThreadPool are thread-safe. The destructor waits until
+ * all submitted tasks have been executed or cancelled.
+ *
+ * @newin{2,90}
+ */
+class GLIBMM_API ThreadPool
+{
+public:
+  /** A cancellation check. It is called in a worker thread.
+   * If it returns <tt>true</tt>, the task is not executed.
+   */
+  using SlotIsCancelled = sigc::slot<bool()>;
+
+  /** A slot that receives the result of a task, as a ready <tt>std::future</tt>.
+   * For instance,
+   * @code
+   * void on_done(std::future<T_Result>& result);
+   * @endcode
+   */
+  template <typename T_Result>
+  using SlotDone = sigc::slot<void(std::future<T_Result>&)>;
+
+  /** Creates a thread pool.
+   * @param n_threads The number of worker threads.
+   *        If 0, <tt>std::thread::hardware_concurrency()</tt> threads are created.
+   */
+  explicit ThreadPool(unsigned int n_threads = 0);
+
+  /** Waits until all submitted tasks have been executed or cancelled,
+   * and joins the worker threads.
+   */
+  ~ThreadPool() noexcept;
+
+  // noncopyable
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+
+  /// The number of worker threads.
+  unsigned int get_n_threads() const;
+
+  /// The number of tasks that wait to be executed.
+  unsigned int get_n_queued() const;
+
+  /** Submits a task.
+   *
+   * @param func A callable that takes no arguments. It's executed in a worker thread.
+   * @param is_cancelled An optional cancellation check.
+   * @return A future that receives the return value of @a func, or the
+   *         exception thrown by @a func.
+   */
+  template <typename T_Func>
+  std::future<std::invoke_result_t<std::decay_t<T_Func>>>
+  submit(T_Func&& func, const SlotIsCancelled& is_cancelled = {});
+
+  /** Submits a task whose result is delivered in a main context.
+   *
+   * When @a func has been executed, @a slot_done is invoked in @a context,
+   * with a ready <tt>std::future</tt> as its argument. <tt>get()</tt> returns
+   * the return value of @a func, or rethrows its exception. If the task is
+   * cancelled, @a slot_done is invoked too, and <tt>get()</tt> throws
+   * <tt>std::future_error</tt>.
+   *
+   * @param func A callable that takes no arguments. It's executed in a worker thread.
+   * @param slot_done Receives the result. Its template argument is the return
+   *        type of @a func.
+   * @param context The main context where @a slot_done is invoked.
+   * @param is_cancelled An optional cancellation check.
+   * @param priority The priority of the idle source that invokes @a slot_done.
+   */
+  template <typename T_Func>
+  void submit(T_Func&& func,
+    const SlotDone<std::invoke_result_t<std::decay_t<T_Func>>>& slot_done,
+    const Glib::RefPtr<MainContext>& context, const SlotIsCancelled& is_cancelled = {},
+    int priority = PRIORITY_DEFAULT);
+
+private:
+  // A type-erased task. A slot can't hold a std::packaged_task,
+  // because std::packaged_task is not copyable.
+  class Task
+  {
+  public:
+    virtual ~Task() noexcept;
+    virtual void run() = 0;
+  };
+
+  template <typename T_Result>
+  class PackagedTask : public Task
+  {
+  public:
+    PackagedTask(std::packaged_task<T_Result()>&& task, const SlotIsCancelled& is_cancelled)
+    : task_(std::move(task)), is_cancelled_(is_cancelled)
+    {}
+
+    void run() override
+    {
+      // If the task is cancelled, task_ is destroyed without being called.
+      // That makes the future throw std::future_error(broken_promise).
+      if (is_cancelled_.empty() || !is_cancelled_())
+        task_();
+    }
+
+  protected:
+    std::packaged_task<T_Result()> task_;
+    SlotIsCancelled is_cancelled_;
+  };
+
+  template <typename T_Result>
+  class ContextTask : public PackagedTask<T_Result>
+  {
+  public:
+    ContextTask(std::packaged_task<T_Result()>&& task, const SlotIsCancelled& is_cancelled,
+      const SlotDone<T_Result>& slot_done, const Glib::RefPtr<MainContext>& context, int priority)
+    : PackagedTask<T_Result>(std::move(task), is_cancelled),
+      slot_done_(slot_done),
+      context_(context),
+      priority_(priority)
+    {}
+
+    void run() override
+    {
+      auto future = std::make_shared<std::future<T_Result>>(this->task_.get_future());
+      PackagedTask<T_Result>::run();
+      // Release the packaged task now. If it was not called,
+      // this makes the future ready with a broken_promise error.
+      this->task_ = std::packaged_task<T_Result()>();
+
+      // Not MainContext::invoke(). It would call slot_done in this worker
+      // thread, if it can acquire a context that no thread owns.
+      const SlotDone<T_Result> slot_done = slot_done_;
+      context_->signal_idle().connect_once(
+        [future, slot_done]() { slot_done(*future); }, priority_);
+    }
+
+  private:
+    SlotDone<T_Result> slot_done_;
+    Glib::RefPtr<MainContext> context_;
+    int priority_;
+  };
+
+  void push(std::unique_ptr<Task> task);
+
+  struct Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+template <typename T_Func>
+std::future<std::invoke_result_t<std::decay_t<T_Func>>>
+ThreadPool::submit(T_Func&& func, const SlotIsCancelled& is_cancelled)
+{
+  using ResultType = std::invoke_result_t<std::decay_t<T_Func>>;
+
+  std::packaged_task<ResultType()> task(std::forward<T_Func>(func));
+  auto future = task.get_future();
+  push(std::make_unique<PackagedTask<ResultType>>(std::move(task), is_cancelled));
+  return future;
+}
+
+template <typename T_Func>
+void
+ThreadPool::submit(T_Func&& func,
+  const SlotDone<std::invoke_result_t<std::decay_t<T_Func>>>& slot_done,
+  const Glib::RefPtr<MainContext>& context, const SlotIsCancelled& is_cancelled, int priority)
+{
+  using ResultType = std::invoke_result_t<std::decay_t<T_Func>>;
+
+  std::packaged_task<ResultType()> task(std::forward<T_Func>(func));
+  push(std::make_unique<ContextTask<ResultType>>(
+    std::move(task), is_cancelled, slot_done, context, priority));
+}
+
+#endif // DOXYGEN_SHOULD_SKIP_THIS
+
+} // namespace Glib
+
+#endif /* _GLIBMM_THREADPOOL_H */
@@ -0,0 +1,736 @@
+/* Copyright (C) 2026 The glibmm Development Team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <glibmm/timestamp.h>
+#include <cstring>
+#include <type_traits>
+
+static_assert(std::is_trivially_copyable<Glib::Timestamp>::value,
+  "Glib::Timestamp must be trivially copyable");
+
+namespace
+{
+
+constexpr gint64 usec_per_day = G_USEC_PER_SEC * gint64(86400);
+
+// U+2007 FIGURE SPACE, which DateTime::format() pads %e, %k and %l with.
+const char figure_space[] = "\xe2\x80\x87";
+
+constexpr gint64
+floor_div(gint64 a, gint64 b)
+{
+  return a >= 0 ? a / b : -((-a - 1) / b) - 1;
+}
+
+// Days since 1970-01-01 in the proleptic Gregorian calendar.
+// Algorithm by Howard Hinnant, http://howardhinnant.github.io/date_algorithms.html
+constexpr gint64
+days_from_civil(gint64 year, int month, int day)
+{
+  year -= month <= 2;
+  const gint64 era = floor_div(year, 400);
+  const gint64 year_of_era = year - era * 400;
+  const gint64 day_of_year = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+  const gint64 day_of_era = year_of_era * 365 + year_of_era / 4 - year_of_era / 100 + day_of_year;
+  return era * 146097 + day_of_era - 719468;
+}
+
+bool
+is_leap_year(int year)
+{
+  return (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+}
+
+int
+days_in_month(int year, int month)
+{
+  static const int days[] = { 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+  return month == 2 && is_leap_year(year) ? 29 : days[month - 1];
+}
+
+// The fields of the local time of a Glib::Timestamp.
+struct Civil
+{
+  gint64 days; // Since 1970-01-01.
+  gint64 year;
+  int month;
+  int day;
+  int hour;
+  int minute;
+  int second;
+  int microsecond;
+
+  explicit Civil(const Glib::Timestamp& timestamp)
+  {
+    const gint64 local =
+      timestamp.to_unix_usec() + gint64(timestamp.get_utc_offset_seconds()) * G_USEC_PER_SEC;
+    days = floor_div(local, usec_per_day);
+    gint64 time = local - days * usec_per_day;
+    microsecond = time % G_USEC_PER_SEC;
+    time /= G_USEC_PER_SEC;
+    second = time % 60;
+    minute = time / 60 % 60;
+    hour = time / 3600;
+
+    const gint64 z = days + 719468;
+    const gint64 era = floor_div(z, 146097);
+    const gint64 day_of_era = z - era * 146097;
+    const gint64 year_of_era =
+      (day_of_era - day_of_era / 1460 + day_of_era / 36524 - day_of_era / 146096) / 365;
+    const gint64 day_of_year = day_of_era - (365 * year_of_era + year_of_era / 4 - year_of_era / 100);
+    const gint64 mp = (5 * day_of_year + 2) / 153;
+    day = day_of_year - (153 * mp + 2) / 5 + 1;
+    month = mp < 10 ? mp + 3 : mp - 9;
+    year = year_of_era + era * 400 + (month <= 2);
+  }
+
+  // The range of GDateTime.
+  bool in_range() const { return year >= 1 && year <= 9999; }
+
+  // 1 (Monday) to 7 (Sunday). 1970-01-01 was a Thursday.
+  int day_of_week() const { return (days % 7 + 7 + 3) % 7 + 1; }
+
+  int day_of_year() const { return days - days_from_civil(year, 1, 1) + 1; }
+};
+
+// Writes to a buffer with strftime() semantics: Nothing is reported as
+// written if the output does not fit.
+class Writer
+{
+public:
+  Writer(char* buffer, std::size_t size)
+  : begin_(buffer), pos_(buffer), end_(size ? buffer + size - 1 : buffer), ok_(size > 0),
+    empty_(size == 0)
+  {
+  }
+
+  void put(char c)
+  {
+    if (pos_ < end_)
+      *pos_++ = c;
+    else
+      ok_ = false;
+  }
+
+  void put(const char* str, std::size_t length)
+  {
+    if (std::size_t(end_ - pos_) >= length)
+    {
+      std::memcpy(pos_, str, length);
+      pos_ += length;
+    }
+    else
+      ok_ = false;
+  }
+
+  // Writes a non-negative number with at least width digits.
+  void put_number(guint64 value, int width)
+  {
+    char digits[20];
+    int n = 0;
+    do
+    {
+      digits[n++] = '0' + value % 10;
+      value /= 10;
+    } while (value);
+    for (; width > n; --width)
+      put('0');
+    while (n)
+      put(digits[--n]);
+  }
+
+  // Writes a number from 0 to 99, padded with a figure space.
+  void put_figure_padded(int value)
+  {
+    if (value < 10)
+    {
+      put(figure_space, sizeof(figure_space) - 1);
+      put('0' + value);
+    }
+    else
+      put_number(value, 2);
+  }
+
+  void put_utc_offset(int offset, int colons)
+  {
+    put(offset >= 0 ? '+' : '-');
+    const int abs_offset = offset >= 0 ? offset : -offset;
+    const int hours = abs_offset / 3600;
+    const int minutes = abs_offset / 60 % 60;
+    const int seconds = abs_offset % 60;
+    put_number(hours, 2);
+    if (colons == 3 && minutes == 0 && seconds == 0)
+      return;
+    if (colons > 0)
+      put(':');
+    put_number(minutes, 2);
+    if (colons == 2 || (colons == 3 && seconds != 0))
+    {
+      put(':');
+      put_number(seconds, 2);
+    }
+  }
+
+  std::size_t finish()
+  {
+    if (!ok_)
+    {
+      if (!empty_)
+        *begin_ = '\0';
+      return 0;
+    }
+    *pos_ = '\0';
+    return pos_ - begin_;
+  }
+
+private:
+  char* const begin_;
+  char* pos_;
+  char* const end_;
+  bool ok_;
+  const bool empty_;
+};
+
+bool
+parse_digits(const char* str, int n_digits, int& value)
+{
+  value = 0;
+  for (int i = 0; i < n_digits; ++i)
+  {
+    if (str[i] < '0' || str[i] > '9')
+      return false;
+    value = value * 10 + (str[i] - '0');
+  }
+  return true;
+}
+
+// Parses YYYY-MM-DDThh:mm:ss[.ffffff][Z|±hh[[:]mm]].
+// Returns false for anything else, including invalid dates, which are then
+// passed to g_date_time_new_from_iso8601().
+bool
+parse_common_iso8601(std::string_view text, int default_offset, gint64& usec, int& offset)
+{
+  if (text.size() < 19)
+    return false;
+
+  const char* p = text.data();
+  const char* const end = p + text.size();
+  int year, month, day, hour, minute, second;
+  if (!parse_digits(p, 4, year) || p[4] != '-' || !parse_digits(p + 5, 2, month) ||
+      p[7] != '-' || !parse_digits(p + 8, 2, day) ||
+      (p[10] != 'T' && p[10] != 't' && p[10] != ' ') ||
+      !parse_digits(p + 11, 2, hour) || p[13] != ':' || !parse_digits(p + 14, 2, minute) ||
+      p[16] != ':' || !parse_digits(p + 17, 2, second))
+    return false;
+  p += 19;
+
+  int microsecond = 0;
+  if (p < end && (*p == '.' || *p == ','))
+  {
+    ++p;
+    int n_digits = 0;
+    for (; p < end && *p >= '0' && *p <= '9'; ++p, ++n_digits)
+    {
+      // More digits would have to be rounded as GLib does.
+      if (n_digits == 6)
+        return false;
+      microsecond = microsecond * 10 + (*p - '0');
+    }
+    if (n_digits == 0)
+      return false;
+    for (; n_digits < 6; ++n_digits)
+      microsecond *= 10;
+  }
+
+  if (p == end)
+    offset = default_offset;
+  else if (*p == 'Z' && p + 1 == end)
+    offset = 0;
+  else if (*p == '+' || *p == '-')
+  {
+    const int sign = *p == '-' ? -1 : 1;
+    ++p;
+    int offset_hours = 0;
+    int offset_minutes = 0;
+    const std::size_t length = end - p;
+    if ((length != 2 && length != 4 && length != 5) || !parse_digits(p, 2, offset_hours) ||
+        offset_hours > 23)
+      return false;
+    if (length == 4)
+    {
+      if (!parse_digits(p + 2, 2, offset_minutes))
+        return false;
+    }
+    else if (length == 5)
+    {
+      if (p[2] != ':' || !parse_digits(p + 3, 2, offset_minutes))
+        return false;
+    }
+    if (offset_minutes > 59)
+      return false;
+    offset = sign * (offset_hours * 3600 + offset_minutes * 60);
+  }
+  else
+    return false;
+
+  if (year < 1 || month < 1 || month > 12 || day < 1 || day > days_in_month(year, month) ||
+      hour > 23 || minute > 59 || second > 59)
+    return false;
+
+  const gint64 seconds =
+    ((days_from_civil(year, month, day) * 24 + hour) * 60 + minute) * 60 + second - offset;
+  usec = seconds * G_USEC_PER_SEC + microsecond;
+  return true;
+}
+
+int
+find_utc_offset(GTimeZone* tz, gint64 unix_time)
+{
+  const int interval = g_time_zone_find_interval(tz, G_TIME_TYPE_UNIVERSAL, unix_time);
+  return interval >= 0 ? g_time_zone_get_offset(tz, interval) : 0;
+}
+
+int
+find_local_utc_offset(gint64 unix_time)
+{
+  // GLib caches the local time zone, so this does not parse it again.
+  GTimeZone* const tz = g_time_zone_new_local();
+  const int offset = find_utc_offset(tz, unix_time);
+  g_time_zone_unref(tz);
+  return offset;
+}
+
+} // anonymous namespace
+
+namespace Glib
+{
+
+// static
+Timestamp
+Timestamp::now_utc() noexcept
+{
+  return Timestamp(g_get_real_time());
+}
+
+// static
+Timestamp
+Timestamp::now_local() noexcept
+{
+  return Timestamp(g_get_real_time()).to_local();
+}
+
+// static
+Timestamp
+Timestamp::create_utc(int year, int month, int day, int hour, int minute, int second,
+  int microsecond) noexcept
+{
+  g_return_val_if_fail(month >= 1 && month <= 12, Timestamp());
+
+  const gint64 days = days_from_civil(year, month, 1) + day - 1;
+  const gint64 seconds = ((days * 24 + hour) * 60 + minute) * 60 + second;
+  return Timestamp(seconds * G_USEC_PER_SEC + microsecond);
+}
+
+// static
+Timestamp
+Timestamp::from_date_time(const DateTime& date_time)
+{
+  g_return_val_if_fail(date_time, Timestamp());
+
+  return Timestamp(date_time.to_unix_usec(), date_time.get_utc_offset() / G_TIME_SPAN_SECOND);
+}
+
+DateTime
+Timestamp::to_date_time() const
+{
+  GDateTime* const utc = g_date_time_new_from_unix_utc_usec(usec_);
+  if (!utc || offset_ == 0)
+    return Glib::wrap(utc);
+
+  GTimeZone* const tz = g_time_zone_new_offset(offset_);
+  GDateTime* const local = g_date_time_to_timezone(utc, tz);
+  g_time_zone_unref(tz);
+  g_date_time_unref(utc);
+  return Glib::wrap(local);
+}
+
+// static
+std::optional<Timestamp>
+Timestamp::parse_iso8601(std::string_view text, int default_utc_offset_seconds)
+{
+  gint64 usec = 0;
+  int offset = 0;
+  if (parse_common_iso8601(text, default_utc_offset_seconds, usec, offset))
+    return Timestamp(usec, offset);
+
+  if (text.find('\0') != std::string_view::npos)
+    return {};
+
+  const std::string str(text);
+  GTimeZone* const default_tz = g_time_zone_new_offset(default_utc_offset_seconds);
+  GDateTime* const date_time = g_date_time_new_from_iso8601(str.c_str(), default_tz);
+  g_time_zone_unref(default_tz);
+  if (!date_time)
+    return {};
+
+  const Timestamp result(g_date_time_to_unix_usec(date_time),
+    g_date_time_get_utc_offset(date_time) / G_TIME_SPAN_SECOND);
+  g_date_time_unref(date_time);
+  return result;
+}
+
+std::size_t
+Timestamp::format_iso8601(char* buffer, std::size_t size) const noexcept
+{
+  const Civil civil(*this);
+  if (!civil.in_range())
+  {
+    if (size > 0)
+      buffer[0] = '\0';
+    return 0;
+  }
+
+  Writer writer(buffer, size);
+  // The same as "%C%y-%m-%dT%H:%M:%S[.%f]" and "Z" or "%:::z" in
+  // g_date_time_format_iso8601().
+  writer.put_number(civil.year, 4);
+  writer.put('-');
+  writer.put_number(civil.month, 2);
+  writer.put('-');
+  writer.put_number(civil.day, 2);
+  writer.put('T');
+  writer.put_number(civil.hour, 2);
+  writer.put(':');
+  writer.put_number(civil.minute, 2);
+  writer.put(':');
+  writer.put_number(civil.second, 2);
+  if (civil.microsecond != 0)
+  {
+    writer.put('.');
+    writer.put_number(civil.microsecond, 6);
+  }
+  if (offset_ == 0)
+    writer.put('Z');
+  else
+    writer.put_utc_offset(offset_, 3);
+  return writer.finish();
+}
+
+std::string
+Timestamp::format_iso8601() const
+{
+  char buffer[iso8601_buffer_size];
+  return std::string(buffer, format_iso8601(buffer, sizeof(buffer)));
+}
+
+Timestamp
+Timestamp::to_timezone(const TimeZone& tz) const
+{
+  return Timestamp(usec_, find_utc_offset(const_cast<GTimeZone*>(tz.gobj()), to_unix()));
+}
+
+Timestamp
+Timestamp::to_local() const noexcept
+{
+  return Timestamp(usec_, find_local_utc_offset(to_unix()));
+}
+
+int
+Timestamp::get_year() const noexcept
+{
+  return Civil(*this).year;
+}
+
+int
+Timestamp::get_month() const noexcept
+{
+  return Civil(*this).month;
+}
+
+int
+Timestamp::get_day_of_month() const noexcept
+{
+  return Civil(*this).day;
+}
+
+int
+Timestamp::get_day_of_week() const noexcept
+{
+  return Civil(*this).day_of_week();
+}
+
+int
+Timestamp::get_day_of_year() const noexcept
+{
+  return Civil(*this).day_of_year();
+}
+
+int
+Timestamp::get_hour() const noexcept
+{
+  return Civil(*this).hour;
+}
+
+int
+Timestamp::get_minute() const noexcept
+{
+  return Civil(*this).minute;
+}
+
+int
+Timestamp::get_second() const noexcept
+{
+  return Civil(*this).second;
+}
+
+int
+Timestamp::get_microsecond() const noexcept
+{
+  return Civil(*this).microsecond;
+}
+
+TimestampFormat::TimestampFormat(const Glib::ustring& format)
+: format_(format)
+{
+  const std::string& str = format_.raw();
+  std::size_t literal_start = 0;
+
+  const auto add_literal = [this](const char* text, std::size_t length)
+  {
+    if (length == 0)
+      return;
+    // Merge with a preceding literal.
+    if (!parts_.empty() && parts_.back().conversion == 0 &&
+        parts_.back().offset + parts_.back().length == literals_.size())
+      parts_.back().length += length;
+    else
+      parts_.push_back({ 0, 0, guint32(literals_.size()), guint32(length) });
+    literals_.append(text, length);
+  };
+  // Adds the conversions of a composite conversion, such as "Y-m-d" for %F.
+  const auto add_conversions = [this, &add_literal](const char* conversions)
+  {
+    for (; *conversions; ++conversions)
+    {
+      if (*conversions == '-' || *conversions == ':' || *conversions == '/')
+        add_literal(conversions, 1);
+      else
+        parts_.push_back({ *conversions, 0, 0, 0 });
+    }
+  };
+
+  for (std::size_t i = 0; i < str.size(); ++i)
+  {
+    if (str[i] != '%')
+      continue;
+
+    add_literal(str.data() + literal_start, i - literal_start);
+    ++i;
+    guint8 colons = 0;
+    for (; i < str.size() && str[i] == ':'; ++i)
+      ++colons;
+    const char conversion = i < str.size() ? str[i] : '\0';
+    literal_start = i + 1;
+
+    if (colons > 3 || (colons > 0 && conversion != 'z'))
+    {
+      precompiled_ = false;
+      break;
+    }
+
+    switch (conversion)
+    {
+    case 'C': case 'd': case 'e': case 'f': case 'H': case 'I': case 'j': case 'k':
+    case 'l': case 'm': case 'M': case 's': case 'S': case 'u': case 'w': case 'y':
+    case 'Y':
+      parts_.push_back({ conversion, 0, 0, 0 });
+      break;
+    case 'z':
+      parts_.push_back({ conversion, colons, 0, 0 });
+      break;
+    case 'D':
+      add_conversions("m/d/y");
+      break;
+    case 'F':
+      add_conversions("Y-m-d");
+      break;
+    case 'R':
+      add_conversions("H:M");
+      break;
+    case 'T':
+      add_conversions("H:M:S");
+      break;
+    case 'n':
+      add_literal("\n", 1);
+      break;
+    case 't':
+      add_literal("\t", 1);
+      break;
+    case '%':
+      add_literal("%", 1);
+      break;
+    default:
+      // Locale-dependent conversions, %Z, modifiers and invalid conversions.
+      precompiled_ = false;
+      break;
+    }
+    if (!precompiled_)
+      break;
+  }
+
+  if (precompiled_)
+    add_literal(str.data() + literal_start, str.size() - literal_start);
+  else
+  {
+    literals_.clear();
+    parts_.clear();
+  }
+}
+
+std::size_t
+TimestampFormat::format(const Timestamp& timestamp, char* buffer, std::size_t size) const
+{
+  if (precompiled_)
+    return format_precompiled(timestamp, buffer, size);
+
+  Writer writer(buffer, size);
+  const DateTime date_time = timestamp.to_date_time();
+  if (date_time)
+  {
+    const Glib::ustring formatted = date_time.format(format_);
+    writer.put(formatted.data(), formatted.bytes());
+  }
+  return writer.finish();
+}
+
+Glib::ustring
+TimestampFormat::format(const Timestamp& timestamp) const
+{
+  if (!precompiled_)
+  {
+    const DateTime date_time = timestamp.to_date_time();
+    return date_time ? date_time.format(format_) : Glib::ustring();
+  }
+
+  char buffer[128];
+  std::size_t length = format_precompiled(timestamp, buffer, sizeof(buffer));
+  if (length > 0 || parts_.empty())
+    return Glib::ustring(buffer, length);
+
+  // Too long for the buffer, or out of range.
+  std::string result(literals_.size() + 32 * parts_.size(), '\0');
+  length = format_precompiled(timestamp, &result[0], result.size());
+  result.resize(length);
+  return result;
+}
+
+std::size_t
+TimestampFormat::format_precompiled(const Timestamp& timestamp, char* buffer,
+  std::size_t size) const
+{
+  const Civil civil(timestamp);
+  if (!civil.in_range())
+  {
+    if (size > 0)
+      buffer[0] = '\0';
+    return 0;
+  }
+
+  Writer writer(buffer, size);
+  for (const auto& part : parts_)
+  {
+    switch (part.conversion)
+    {
+    case 0:
+      writer.put(literals_.data() + part.offset, part.length);
+      break;
+    case 'C':
+      writer.put_number(civil.year / 100, 2);
+      break;
+    case 'd':
+      writer.put_number(civil.day, 2);
+      break;
+    case 'e':
+      writer.put_figure_padded(civil.day);
+      break;
+    case 'f':
+      writer.put_number(civil.microsecond, 6);
+      break;
+    case 'H':
+      writer.put_number(civil.hour, 2);
+      break;
+    case 'I':
+      writer.put_number(civil.hour % 12 ? civil.hour % 12 : 12, 2);
+      break;
+    case 'j':
+      writer.put_number(civil.day_of_year(), 3);
+      break;
+    case 'k':
+      writer.put_figure_padded(civil.hour);
+      break;
+    case 'l':
+      writer.put_figure_padded(civil.hour % 12 ? civil.hour % 12 : 12);
+      break;
+    case 'm':
+      writer.put_number(civil.month, 2);
+      break;
+    case 'M':
+      writer.put_number(civil.minute, 2);
+      break;
+    case 's':
+    {
+      const gint64 unix_time = timestamp.to_unix();
+      if (unix_time < 0)
+        writer.put('-');
+      writer.put_number(unix_time < 0 ? -guint64(unix_time) : guint64(unix_time), 1);
+      break;
+    }
+    case 'S':
+      writer.put_number(civil.second, 2);
+      break;
+    case 'u':
+      writer.put_number(civil.day_of_week(), 1);
+      break;
+    case 'w':
+      writer.put_number(civil.day_of_week() % 7, 1);
+      break;
+    case 'y':
+      writer.put_number(civil.year % 100, 2);
+      break;
+    case 'Y':
+      writer.put_number(civil.year, 1);
+      break;
+    case 'z':
+      writer.put_utc_offset(timestamp.get_utc_offset_seconds(), part.colons);
+      break;
+    }
+  }
+  return writer.finish();
+}
+
+Glib::ustring
+TimestampFormat::get_format() const
+{
+  return format_;
+}
+
+bool
+TimestampFormat::is_precompiled() const noexcept
+{
+  return precompiled_;
+}
+
+} // namespace Glib
@@ -0,0 +1,288 @@
+#ifndef _GLIBMM_TIMESTAMP_H
+#define _GLIBMM_TIMESTAMP_H
+
+/* Copyright (C) 2026 The glibmm Development Team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <glibmmconfig.h>
+#include <glibmm/datetime.h>
+#include <glibmm/timezone.h>
+#include <glibmm/ustring.h>
+#include <glib.h>
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Glib
+{
+
+/** A point in time with a fixed UTC offset, stored by value.
+ *
+ * %Timestamp is a trivially copyable alternative to DateTime for code that
+ * handles many points in time, such as log pipelines. It holds a number of
+ * microseconds since the Unix epoch and the offset from UTC, in seconds, of
+ * the local time that it represents. Creating, copying and modifying a
+ * %Timestamp never allocates memory, and format_iso8601() writes into a
+ * buffer provided by the caller.
+ *
+ * Unlike a DateTime, a %Timestamp does not refer to a TimeZone. It knows only
+ * the offset that was valid at its point in time. to_timezone() and
+ * to_local() look up the offset of another time zone.
+ *
+ * Use TimestampFormat to format with a strftime()-like format string.
+ *
+ * The calendar methods use the proleptic Gregorian calendar, as DateTime
+ * does. DateTime supports the years 1 to 9999; a %Timestamp outside that
+ * range can be stored and compared, but not converted or formatted.
+ *
+ * @newin{2,90}
+ */
+class GLIBMM_API Timestamp
+{
+public:
+  /** The buffer size that is always large enough for format_iso8601(),
+   * including the terminating nul character.
+   */
+  static constexpr std::size_t iso8601_buffer_size = 36;
+
+  /// Creates a %Timestamp for the Unix epoch, 1970-01-01T00:00:00Z.
+  constexpr Timestamp() noexcept = default;
+
+  /** Creates a %Timestamp.
+   * @param unix_usec The number of microseconds since 1970-01-01T00:00:00Z.
+   * @param utc_offset_seconds The offset from UTC of the local time, in seconds.
+   */
+  constexpr explicit Timestamp(gint64 unix_usec, int utc_offset_seconds = 0) noexcept
+  : usec_(unix_usec), offset_(utc_offset_seconds)
+  {}
+
+  /// Gets the current time in UTC, without allocating a DateTime.
+  static Timestamp now_utc() noexcept;
+
+  /// Gets the current time in the local time zone.
+  static Timestamp now_local() noexcept;
+
+  /** Creates a %Timestamp from a date and time in UTC.
+   * No time zone is looked up. Out-of-range values other than the month are
+   * normalized, so that for instance the 32nd day of January is the 1st of February.
+   * @param month 1 to 12.
+   */
+  static Timestamp create_utc(int year, int month, int day, int hour, int minute,
+    int second, int microsecond = 0) noexcept;
+
+  /** Creates a %Timestamp with the same point in time and UTC offset as @a date_time.
+   * @a date_time must be valid.
+   */
+  static Timestamp from_date_time(const DateTime& date_time);
+
+  /** Creates a DateTime with the same point in time and UTC offset.
+   * The time zone of the DateTime is a fixed-offset zone.
+   * @return The DateTime, which is invalid if the %Timestamp is outside the
+   *         range supported by DateTime.
+   */
+  DateTime to_date_time() const;
+
+  /** Parses an ISO 8601 formatted string, as DateTime::create_from_iso8601() does.
+   *
+   * The common form <tt>YYYY-MM-DDThh:mm:ss[.ffffff](Z|±hh[[:]mm])</tt>, with
+   * 'T', 't' or a space as separator, is parsed without allocating memory.
+   * Other forms, such as week dates, ordinal dates and basic formats, are
+   * passed to g_date_time_new_from_iso8601().
+   *
+   * @param text The string to parse.
+   * @param default_utc_offset_seconds The UTC offset to use if @a text has no
+   *        time zone designator.
+   * @return The parsed %Timestamp, or an empty std::optional if @a text is not
+   *         a valid ISO 8601 date and time.
+   */
+  static std::optional<Timestamp> parse_iso8601(std::string_view text,
+    int default_utc_offset_seconds = 0);
+
+  /** Formats in the ISO 8601 format, as DateTime::format_iso8601() does.
+   * Microseconds are included if they are not 0. The UTC offset is
+   * written as <tt>Z</tt> if it's 0.
+   *
+   * @param buffer The buffer to write to. iso8601_buffer_size bytes are always enough.
+   * @param size The size of @a buffer.
+   * @return The number of bytes written, not counting the terminating nul
+   *         character, or 0 if the string does not fit or the year is
+   *         outside the range 1 to 9999.
+   */
+  std::size_t format_iso8601(char* buffer, std::size_t size) const noexcept;
+
+  /** Formats in the ISO 8601 format.
+   * @return The formatted string, or an empty string if the year is outside
+   *         the range 1 to 9999.
+   */
+  std::string format_iso8601() const;
+
+  /// Gets the number of microseconds since 1970-01-01T00:00:00Z.
+  constexpr gint64 to_unix_usec() const noexcept { return usec_; }
+
+  /// Gets the number of whole seconds since 1970-01-01T00:00:00Z, rounded down.
+  constexpr gint64 to_unix() const noexcept
+  { return usec_ >= 0 ? usec_ / G_USEC_PER_SEC : -((-usec_ - 1) / G_USEC_PER_SEC) - 1; }
+
+  /// Gets the offset from UTC of the local time, in seconds.
+  constexpr int get_utc_offset_seconds() const noexcept { return offset_; }
+
+  /// Gets the offset from UTC of the local time, as DateTime::get_utc_offset() does.
+  constexpr TimeSpan get_utc_offset() const noexcept
+  { return static_cast<TimeSpan>(offset_) * G_TIME_SPAN_SECOND; }
+
+  /// Creates a %Timestamp with the same point in time and a UTC offset of 0.
+  constexpr Timestamp to_utc() const noexcept { return Timestamp(usec_); }
+
+  /// Creates a %Timestamp with the same point in time and another UTC offset.
+  constexpr Timestamp to_utc_offset(int utc_offset_seconds) const noexcept
+  { return Timestamp(usec_, utc_offset_seconds); }
+
+  /** Creates a %Timestamp with the same point in time and the UTC offset
+   * that @a tz has at that time.
+   */
+  Timestamp to_timezone(const TimeZone& tz) const;
+
+  /// Creates a %Timestamp with the same point in time in the local time zone.
+  Timestamp to_local() const noexcept;
+
+  /// Creates a copy of @a *this and adds the specified timespan to the copy.
+  constexpr Timestamp add(TimeSpan timespan) const noexcept
+  { return Timestamp(usec_ + timespan, offset_); }
+
+  /// Creates a copy of @a *this and adds the specified number of seconds to the copy.
+  constexpr Timestamp add_seconds(double seconds) const noexcept
+  { return Timestamp(usec_ + static_cast<gint64>(seconds * G_USEC_PER_SEC), offset_); }
+
+  /// Gets the difference @a *this - @a other.
+  constexpr TimeSpan difference(const Timestamp& other) const noexcept
+  { return usec_ - other.usec_; }
+
+  /// Gets the year of the local time.
+  int get_year() const noexcept;
+  /// Gets the month of the year of the local time, 1 to 12.
+  int get_month() const noexcept;
+  /// Gets the day of the month of the local time, 1 to 31.
+  int get_day_of_month() const noexcept;
+  /// Gets the day of the week of the local time, 1 (Monday) to 7 (Sunday).
+  int get_day_of_week() const noexcept;
+  /// Gets the day of the year of the local time, 1 to 366.
+  int get_day_of_year() const noexcept;
+  /// Gets the hour of the day of the local time, 0 to 23.
+  int get_hour() const noexcept;
+  /// Gets the minute of the hour, 0 to 59.
+  int get_minute() const noexcept;
+  /// Gets the second of the minute, 0 to 59.
+  int get_second() const noexcept;
+  /// Gets the microsecond of the second, 0 to 999999.
+  int get_microsecond() const noexcept;
+
+  // Comparisons compare the points in time. The UTC offsets are ignored.
+  friend constexpr bool operator==(const Timestamp& lhs, const Timestamp& rhs) noexcept
+  { return lhs.usec_ == rhs.usec_; }
+  friend constexpr bool operator!=(const Timestamp& lhs, const Timestamp& rhs) noexcept
+  { return lhs.usec_ != rhs.usec_; }
+  friend constexpr bool operator<(const Timestamp& lhs, const Timestamp& rhs) noexcept
+  { return lhs.usec_ < rhs.usec_; }
+  friend constexpr bool operator<=(const Timestamp& lhs, const Timestamp& rhs) noexcept
+  { return lhs.usec_ <= rhs.usec_; }
+  friend constexpr bool operator>(const Timestamp& lhs, const Timestamp& rhs) noexcept
+  { return lhs.usec_ > rhs.usec_; }
+  friend constexpr bool operator>=(const Timestamp& lhs, const Timestamp& rhs) noexcept
+  { return lhs.usec_ >= rhs.usec_; }
+
+private:
+  gint64 usec_ = 0;
+  gint32 offset_ = 0;
+};
+
+/** A precompiled strftime()-like format for Timestamp.
+ *
+ * The format string is parsed once, by the constructor. format() then writes
+ * into a buffer provided by the caller, without allocating memory.
+ * The conversions are those of DateTime::format(), and the output is the same.
+ *
+ * @code
+ * const Glib::TimestampFormat log_format("%F %T.%f %z");
+ * char buffer[64];
+ * const auto length = log_format.format(Glib::Timestamp::now_local(), buffer, sizeof(buffer));
+ * @endcode
+ *
+ * The conversions that don't depend on the locale are precompiled:
+ * %%C %%d %%D %%e %%f %%F %%H %%I %%j %%k %%l %%m %%M %%n %%R %%s %%S %%t %%T
+ * %%u %%w %%y %%Y %%z %%:z %%::z %%:::z and %%%%. If the format string contains
+ * any other conversion or a modifier, format() converts the %Timestamp to
+ * a DateTime and calls DateTime::format(). is_precompiled() tells which
+ * way is used.
+ *
+ * @newin{2,90}
+ */
+class GLIBMM_API TimestampFormat
+{
+public:
+  /** Parses a format string.
+   * @param format A format string, as described for DateTime::format().
+   */
+  explicit TimestampFormat(const Glib::ustring& format);
+
+  /** Formats a %Timestamp.
+   * @param timestamp The %Timestamp to format.
+   * @param buffer The buffer to write to.
+   * @param size The size of @a buffer.
+   * @return The number of bytes written, not counting the terminating nul
+   *         character, or 0 if the string does not fit or the %Timestamp is
+   *         outside the range supported by DateTime.
+   */
+  std::size_t format(const Timestamp& timestamp, char* buffer, std::size_t size) const;
+
+  /** Formats a %Timestamp.
+   * @return The formatted string, or an empty string if the %Timestamp is
+   *         outside the range supported by DateTime.
+   */
+  Glib::ustring format(const Timestamp& timestamp) const;
+
+  /// Gets the format string.
+  Glib::ustring get_format() const;
+
+  /** Whether all conversions of the format string are precompiled.
+   * If not, format() calls DateTime::format().
+   */
+  bool is_precompiled() const noexcept;
+
+private:
+  struct Part
+  {
+    // 0 for literal text, else the conversion character.
+    char conversion;
+    // The number of colons in %z, %:z, %::z or %:::z.
+    guint8 colons;
+    // Position of literal text in literals_.
+    guint32 offset;
+    guint32 length;
+  };
+
+  std::size_t format_precompiled(const Timestamp& timestamp, char* buffer, std::size_t size) const;
+
+  Glib::ustring format_;
+  std::string literals_;
+  std::vector<Part> parts_;
+  bool precompiled_ = true;
+};
+
+} // namespace Glib
+
+#endif /* _GLIBMM_TIMESTAMP_H */
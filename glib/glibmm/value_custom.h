@@ -24,9 +24,11 @@
 #endif
 
 #include <glibmmconfig.h>
+#include <cstring>
 #include <new>
 #include <typeinfo>
 #include <type_traits>
+#include <utility>
 
 namespace Glib
 {
@@ -94,6 +96,36 @@ private:
   inline CppType get_(void*) const;
 };
 
+namespace Traits
+{
+/** Selects inline storage for Glib::Value<T>.
+ * @ingroup glibmmValue
+ * By default the generic Glib::Value<T> allocates a @a T on the heap for each
+ * GValue, and copies of the GValue allocate again. If @a T is trivially
+ * copyable and fits in the storage of a GValue (usually 16 bytes), you can
+ * specialize this template to derive from <tt>std::true_type</tt>. The
+ * value is then stored in the GValue itself, and initialization, copying and
+ * freeing are allocation-free:
+ * @code
+ * struct Point { int x; int y; };
+ * namespace Glib::Traits
+ * {
+ * template <> struct ValueInlineStorage<Point> : std::true_type {};
+ * }
+ * @endcode
+ *
+ * The specialization must be visible wherever Glib::Value<T> is used,
+ * including in all libraries that exchange such values. An inline value
+ * must not be accessed with g_value_get_boxed() or g_boxed_copy().
+ *
+ * @newin{2,90}
+ */
+template <typename T>
+struct ValueInlineStorage : std::false_type
+{
+};
+} // namespace Traits
+
 /** Generic value implementation for custom types.
  * @ingroup glibmmValue
  * Any type to be used with this template must implement:
@@ -109,6 +141,9 @@ private:
  * @note None of the operations listed above are allowed to throw.  If you
  * cannot ensure that no exceptions will be thrown, consider using either
  * a normal pointer or a smart pointer to hold your objects indirectly.
+ *
+ * Small trivially copyable types can be stored without memory allocation.
+ * See Glib::Traits::ValueInlineStorage.
  */
 template <class T, typename Enable = void>
 class Value : public ValueBase_Boxed
@@ -132,9 +167,24 @@ public:
   static GType value_type() G_GNUC_CONST;
 
   inline void set(const CppType& data);
+
+  /** Moves @a data into the value.
+   * @newin{2,90}
+   */
+  inline void set(CppType&& data);
+
   inline CppType get() const;
 
 private:
+  static constexpr bool stored_inline_ = Traits::ValueInlineStorage<T>::value;
+
+  static_assert(!stored_inline_ || std::is_trivially_copyable<T>::value,
+    "Glib::Traits::ValueInlineStorage: T should be trivially copyable");
+  static_assert(!stored_inline_ || sizeof(T) <= sizeof(GValue::data),
+    "Glib::Traits::ValueInlineStorage: T should fit in GValue::data");
+  static_assert(!stored_inline_ || alignof(T) <= alignof(GValue),
+    "Glib::Traits::ValueInlineStorage: T should not need more alignment than GValue");
+
   static GType custom_type_;
 
   static void value_init_func(GValue* value);
@@ -259,16 +309,36 @@ template <class T, typename Enable>
 inline void
 Value<T, Enable>::set(const typename Value<T, Enable>::CppType& data)
 {
-  // Assume the value is already default-initialized.  See value_init_func().
-  *static_cast<T*>(gobject_.data[0].v_pointer) = data;
+  if constexpr (stored_inline_)
+    std::memcpy(gobject_.data, &data, sizeof(T));
+  else
+    // Assume the value is already default-initialized.  See value_init_func().
+    *static_cast<T*>(gobject_.data[0].v_pointer) = data;
+}
+
+template <class T, typename Enable>
+inline void
+Value<T, Enable>::set(typename Value<T, Enable>::CppType&& data)
+{
+  if constexpr (stored_inline_)
+    std::memcpy(gobject_.data, &data, sizeof(T));
+  else
+    *static_cast<T*>(gobject_.data[0].v_pointer) = std::move(data);
 }
 
 template <class T, typename Enable>
 inline typename Value<T, Enable>::CppType
 Value<T, Enable>::get() const
 {
-  // Assume the pointer is not NULL.  See value_init_func().
-  return *static_cast<T*>(gobject_.data[0].v_pointer);
+  if constexpr (stored_inline_)
+  {
+    T data;
+    std::memcpy(&data, gobject_.data, sizeof(T));
+    return data;
+  }
+  else
+    // Assume the pointer is not NULL.  See value_init_func().
+    return *static_cast<T*>(gobject_.data[0].v_pointer);
 }
 
 // static
@@ -289,8 +359,14 @@ template <class T, typename Enable>
 void
 Value<T, Enable>::value_init_func(GValue* value)
 {
-  // Never store a NULL pointer (unless we're out of memory).
-  value->data[0].v_pointer = new (std::nothrow) T();
+  if constexpr (stored_inline_)
+  {
+    const T data{};
+    std::memcpy(value->data, &data, sizeof(T));
+  }
+  else
+    // Never store a NULL pointer (unless we're out of memory).
+    value->data[0].v_pointer = new (std::nothrow) T();
 }
 
 // static
@@ -298,7 +374,9 @@ template <class T, typename Enable>
 void
 Value<T, Enable>::value_free_func(GValue* value)
 {
-  delete static_cast<T*>(value->data[0].v_pointer);
+  // An inline T is trivially destructible.
+  if constexpr (!stored_inline_)
+    delete static_cast<T*>(value->data[0].v_pointer);
 }
 
 // static
@@ -306,9 +384,14 @@ template <class T, typename Enable>
 void
 Value<T, Enable>::value_copy_func(const GValue* src_value, GValue* dest_value)
 {
-  // Assume the source is not NULL.  See value_init_func().
-  const T& source = *static_cast<T*>(src_value->data[0].v_pointer);
-  dest_value->data[0].v_pointer = new (std::nothrow) T(source);
+  if constexpr (stored_inline_)
+    std::memcpy(dest_value->data, src_value->data, sizeof(T));
+  else
+  {
+    // Assume the source is not NULL.  See value_init_func().
+    const T& source = *static_cast<T*>(src_value->data[0].v_pointer);
+    dest_value->data[0].v_pointer = new (std::nothrow) T(source);
+  }
 }
 
 namespace Traits
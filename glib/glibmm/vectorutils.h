@@ -424,6 +424,202 @@ private:
 
 } // namespace Container_Helpers
 
+/** A read-only view of a C array, which converts the elements when they are accessed.
+ *
+ * Where ArrayHandler::array_to_vector() converts all elements of a C array
+ * to C++ at once, %ArrayView keeps the C array and converts an element
+ * only when it is dereferenced. This is cheaper if only some of the elements
+ * are used, or if the elements are used only once, e.g. in a range-based for loop.
+ * Each dereference converts the element again, so store the result if an
+ * element is used repeatedly.
+ *
+ * The view owns the C array, as specified by the ownership type, and frees it
+ * when it is destroyed. It can be moved, but not copied. It is converted to a
+ * std::vector if the caller needs one, so code that stores the result of a
+ * function that returns a view in a std::vector does not have to be changed.
+ *
+ * @code
+ * for (const auto& name : file_info->list_attributes_view())
+ *   if (name == "standard::name")
+ *     found = true;
+ * @endcode
+ *
+ * @newin{2,90}
+ */
+template <typename T, typename Tr = Glib::Container_Helpers::TypeTraits<T>>
+class ArrayView
+{
+public:
+  using CType = typename Tr::CType;
+  using value_type = T;
+  using size_type = std::size_t;
+  using const_iterator = Glib::Container_Helpers::ArrayIterator<Tr>;
+  using iterator = const_iterator;
+  using VectorType = std::vector<T>;
+
+  ArrayView() noexcept = default;
+
+  /** Constructs a view of @a array, with @a array_size elements.
+   * @param array The C array.
+   * @param array_size The number of elements in @a array.
+   * @param ownership What the view frees when it is destroyed.
+   */
+  inline ArrayView(const CType* array, std::size_t array_size, Glib::OwnershipType ownership);
+
+  /** Constructs a view of a 0-terminated @a array.
+   * The size of the array is computed only if it is needed.
+   * @param array The C array.
+   * @param ownership What the view frees when it is destroyed.
+   */
+  inline ArrayView(const CType* array, Glib::OwnershipType ownership);
+
+  inline ArrayView(ArrayView&& src) noexcept;
+  inline ArrayView& operator=(ArrayView&& src) noexcept;
+  ~ArrayView() noexcept;
+
+  // noncopyable
+  ArrayView(const ArrayView&) = delete;
+  ArrayView& operator=(const ArrayView&) = delete;
+
+  inline const_iterator begin() const;
+  inline const_iterator end() const;
+  inline size_type size() const;
+  inline bool empty() const;
+
+  /// Converts the element at @a index.
+  inline value_type operator[](size_type index) const;
+  /// Converts the first element. The view must not be empty.
+  inline value_type front() const;
+
+  /// Converts all elements.
+  inline VectorType to_vector() const;
+  inline operator VectorType() const;
+
+  /// Gets the C array. It is owned by the view.
+  inline const CType* data() const;
+
+private:
+  void release() noexcept;
+
+  CType* array_ = nullptr;
+  // Computed when needed, if the array is 0-terminated.
+  mutable std::size_t array_size_ = 0;
+  mutable bool size_known_ = true;
+  Glib::OwnershipType ownership_ = Glib::OWNERSHIP_NONE;
+};
+
+/** A read-only view of a GList, which converts the elements when they are accessed.
+ *
+ * Like ArrayView, but for a GList. The view owns the list, as specified by
+ * the ownership type.
+ *
+ * @newin{2,90}
+ */
+template <typename T, typename Tr = Glib::Container_Helpers::TypeTraits<T>>
+class ListView
+{
+public:
+  using value_type = T;
+  using size_type = std::size_t;
+  using const_iterator = Glib::Container_Helpers::ListIterator<Tr>;
+  using iterator = const_iterator;
+  using VectorType = std::vector<T>;
+
+  ListView() noexcept = default;
+
+  /** Constructs a view of @a glist.
+   * @param glist The list.
+   * @param ownership What the view frees when it is destroyed.
+   */
+  inline ListView(GList* glist, Glib::OwnershipType ownership);
+
+  inline ListView(ListView&& src) noexcept;
+  inline ListView& operator=(ListView&& src) noexcept;
+  ~ListView() noexcept;
+
+  // noncopyable
+  ListView(const ListView&) = delete;
+  ListView& operator=(const ListView&) = delete;
+
+  inline const_iterator begin() const;
+  inline const_iterator end() const;
+  /// Counts the elements. This walks the list.
+  inline size_type size() const;
+  inline bool empty() const;
+
+  /// Converts the first element. The view must not be empty.
+  inline value_type front() const;
+
+  /// Converts all elements.
+  inline VectorType to_vector() const;
+  inline operator VectorType() const;
+
+  /// Gets the list. It is owned by the view.
+  inline const GList* data() const;
+
+private:
+  void release() noexcept;
+
+  GList* glist_ = nullptr;
+  Glib::OwnershipType ownership_ = Glib::OWNERSHIP_NONE;
+};
+
+/** A read-only view of a GSList, which converts the elements when they are accessed.
+ *
+ * Like ArrayView, but for a GSList. The view owns the list, as specified by
+ * the ownership type.
+ *
+ * @newin{2,90}
+ */
+template <typename T, typename Tr = Glib::Container_Helpers::TypeTraits<T>>
+class SListView
+{
+public:
+  using value_type = T;
+  using size_type = std::size_t;
+  using const_iterator = Glib::Container_Helpers::SListIterator<Tr>;
+  using iterator = const_iterator;
+  using VectorType = std::vector<T>;
+
+  SListView() noexcept = default;
+
+  /** Constructs a view of @a gslist.
+   * @param gslist The list.
+   * @param ownership What the view frees when it is destroyed.
+   */
+  inline SListView(GSList* gslist, Glib::OwnershipType ownership);
+
+  inline SListView(SListView&& src) noexcept;
+  inline SListView& operator=(SListView&& src) noexcept;
+  ~SListView() noexcept;
+
+  // noncopyable
+  SListView(const SListView&) = delete;
+  SListView& operator=(const SListView&) = delete;
+
+  inline const_iterator begin() const;
+  inline const_iterator end() const;
+  /// Counts the elements. This walks the list.
+  inline size_type size() const;
+  inline bool empty() const;
+
+  /// Converts the first element. The view must not be empty.
+  inline value_type front() const;
+
+  /// Converts all elements.
+  inline VectorType to_vector() const;
+  inline operator VectorType() const;
+
+  /// Gets the list. It is owned by the view.
+  inline const GSList* data() const;
+
+private:
+  void release() noexcept;
+
+  GSList* gslist_ = nullptr;
+  Glib::OwnershipType ownership_ = Glib::OWNERSHIP_NONE;
+};
+
 // Note that this is a struct instead of templated functions because standard template arguments
 // for function templates is a C++0x feature.
 /** A utility for converting between std::vector and plain C arrays.
@@ -471,12 +667,27 @@ public:
   using VectorType = std::vector<CppType>;
   using ArrayKeeperType = typename Glib::Container_Helpers::ArrayKeeper<Tr>;
   using ArrayIteratorType = typename Glib::Container_Helpers::ArrayIterator<Tr>;
+  using ViewType = ArrayView<T, Tr>;
 
   // maybe think about using C++0x move constructors?
   static VectorType array_to_vector(
     const CType* array, std::size_t array_size, Glib::OwnershipType ownership);
   static VectorType array_to_vector(const CType* array, Glib::OwnershipType ownership);
   static ArrayKeeperType vector_to_array(const VectorType& vector);
+
+  /** Creates a view that converts the elements of @a array when they are accessed.
+   * @newin{2,90}
+   */
+  static ViewType array_to_view(
+    const CType* array, std::size_t array_size, Glib::OwnershipType ownership)
+  { return ViewType(array, array_size, ownership); }
+
+  /** Creates a view that converts the elements of the 0-terminated @a array
+   * when they are accessed.
+   * @newin{2,90}
+   */
+  static ViewType array_to_view(const CType* array, Glib::OwnershipType ownership)
+  { return ViewType(array, ownership); }
 };
 
 template <>
@@ -534,10 +745,17 @@ public:
   using VectorType = std::vector<CppType>;
   using GListKeeperType = typename Glib::Container_Helpers::GListKeeper<Tr>;
   using ListIteratorType = typename Glib::Container_Helpers::ListIterator<Tr>;
+  using ViewType = ListView<T, Tr>;
 
   // maybe think about using C++0x move constructors?
   static VectorType list_to_vector(GList* glist, Glib::OwnershipType ownership);
   static GListKeeperType vector_to_list(const VectorType& vector);
+
+  /** Creates a view that converts the elements of @a glist when they are accessed.
+   * @newin{2,90}
+   */
+  static ViewType list_to_view(GList* glist, Glib::OwnershipType ownership)
+  { return ViewType(glist, ownership); }
 };
 
 /** A utility for converting between std::vector and GSList.
@@ -575,10 +793,17 @@ public:
   using VectorType = std::vector<CppType>;
   using GSListKeeperType = typename Glib::Container_Helpers::GSListKeeper<Tr>;
   using SListIteratorType = typename Glib::Container_Helpers::SListIterator<Tr>;
+  using ViewType = SListView<T, Tr>;
 
   // maybe think about using C++0x move constructors?
   static VectorType slist_to_vector(GSList* gslist, Glib::OwnershipType ownership);
   static GSListKeeperType vector_to_slist(const VectorType& vector);
+
+  /** Creates a view that converts the elements of @a gslist when they are accessed.
+   * @newin{2,90}
+   */
+  static ViewType slist_to_view(GSList* gslist, Glib::OwnershipType ownership)
+  { return ViewType(gslist, ownership); }
 };
 
 /***************************************************************************/
@@ -767,7 +992,7 @@ inline SListIterator<Tr>& SListIterator<Tr>::operator++()
 template <class Tr>
 inline const SListIterator<Tr> SListIterator<Tr>::operator++(int)
 {
-  const ListIterator<Tr> tmp(*this);
+  const SListIterator<Tr> tmp(*this);
   node_ = node_->next;
   return tmp;
 }
@@ -1003,6 +1228,352 @@ SListHandler<T, Tr>::vector_to_slist(const VectorType& vector)
     Glib::OWNERSHIP_SHALLOW);
 }
 
+/**** Glib::ArrayView<> ************************/
+
+template <typename T, class Tr>
+inline ArrayView<T, Tr>::ArrayView(
+  const CType* array, std::size_t array_size, Glib::OwnershipType ownership)
+: array_(const_cast<CType*>(array)), array_size_(array ? array_size : 0), ownership_(ownership)
+{
+}
+
+template <typename T, class Tr>
+inline ArrayView<T, Tr>::ArrayView(const CType* array, Glib::OwnershipType ownership)
+: array_(const_cast<CType*>(array)), size_known_(!array), ownership_(ownership)
+{
+}
+
+template <typename T, class Tr>
+inline ArrayView<T, Tr>::ArrayView(ArrayView&& src) noexcept
+: array_(src.array_),
+  array_size_(src.array_size_),
+  size_known_(src.size_known_),
+  ownership_(src.ownership_)
+{
+  src.array_ = nullptr;
+  src.array_size_ = 0;
+  src.size_known_ = true;
+}
+
+template <typename T, class Tr>
+inline ArrayView<T, Tr>&
+ArrayView<T, Tr>::operator=(ArrayView&& src) noexcept
+{
+  if (&src != this)
+  {
+    release();
+    array_ = src.array_;
+    array_size_ = src.array_size_;
+    size_known_ = src.size_known_;
+    ownership_ = src.ownership_;
+    src.array_ = nullptr;
+    src.array_size_ = 0;
+    src.size_known_ = true;
+  }
+  return *this;
+}
+
+template <typename T, class Tr>
+ArrayView<T, Tr>::~ArrayView() noexcept
+{
+  release();
+}
+
+template <typename T, class Tr>
+void
+ArrayView<T, Tr>::release() noexcept
+{
+  if (array_ && ownership_ != Glib::OWNERSHIP_NONE)
+  {
+    if (ownership_ != Glib::OWNERSHIP_SHALLOW)
+    {
+      // Deep ownership: release each container element.
+      const CType* const array_end(array_ + size());
+
+      for (const CType* p(array_); p != array_end; ++p)
+      {
+        Tr::release_c_type(*p);
+      }
+    }
+    g_free(array_);
+  }
+  array_ = nullptr;
+}
+
+template <typename T, class Tr>
+inline typename ArrayView<T, Tr>::const_iterator
+ArrayView<T, Tr>::begin() const
+{
+  return const_iterator(array_);
+}
+
+template <typename T, class Tr>
+inline typename ArrayView<T, Tr>::const_iterator
+ArrayView<T, Tr>::end() const
+{
+  return const_iterator(array_ + size());
+}
+
+template <typename T, class Tr>
+inline typename ArrayView<T, Tr>::size_type
+ArrayView<T, Tr>::size() const
+{
+  if (!size_known_)
+  {
+    array_size_ = Glib::Container_Helpers::compute_array_size2(array_);
+    size_known_ = true;
+  }
+  return array_size_;
+}
+
+template <typename T, class Tr>
+inline bool
+ArrayView<T, Tr>::empty() const
+{
+  // A 0-terminated array is empty if its first element is 0.
+  // There is no need to compute its size.
+  return size_known_ ? array_size_ == 0 : !*array_;
+}
+
+template <typename T, class Tr>
+inline typename ArrayView<T, Tr>::value_type ArrayView<T, Tr>::operator[](size_type index) const
+{
+  return Tr::to_cpp_type(array_[index]);
+}
+
+template <typename T, class Tr>
+inline typename ArrayView<T, Tr>::value_type
+ArrayView<T, Tr>::front() const
+{
+  return Tr::to_cpp_type(*array_);
+}
+
+template <typename T, class Tr>
+inline typename ArrayView<T, Tr>::VectorType
+ArrayView<T, Tr>::to_vector() const
+{
+  return VectorType(begin(), end());
+}
+
+template <typename T, class Tr>
+inline ArrayView<T, Tr>::operator VectorType() const
+{
+  return to_vector();
+}
+
+template <typename T, class Tr>
+inline const typename ArrayView<T, Tr>::CType*
+ArrayView<T, Tr>::data() const
+{
+  return array_;
+}
+
+/**** Glib::ListView<> ************************/
+
+template <typename T, class Tr>
+inline ListView<T, Tr>::ListView(GList* glist, Glib::OwnershipType ownership)
+: glist_(glist), ownership_(ownership)
+{
+}
+
+template <typename T, class Tr>
+inline ListView<T, Tr>::ListView(ListView&& src) noexcept
+: glist_(src.glist_), ownership_(src.ownership_)
+{
+  src.glist_ = nullptr;
+}
+
+template <typename T, class Tr>
+inline ListView<T, Tr>&
+ListView<T, Tr>::operator=(ListView&& src) noexcept
+{
+  if (&src != this)
+  {
+    release();
+    glist_ = src.glist_;
+    ownership_ = src.ownership_;
+    src.glist_ = nullptr;
+  }
+  return *this;
+}
+
+template <typename T, class Tr>
+ListView<T, Tr>::~ListView() noexcept
+{
+  release();
+}
+
+template <typename T, class Tr>
+void
+ListView<T, Tr>::release() noexcept
+{
+  // GListKeeper frees the list, as specified by the ownership.
+  Glib::Container_Helpers::GListKeeper<Tr>(glist_, ownership_);
+  glist_ = nullptr;
+}
+
+template <typename T, class Tr>
+inline typename ListView<T, Tr>::const_iterator
+ListView<T, Tr>::begin() const
+{
+  return const_iterator(glist_);
+}
+
+template <typename T, class Tr>
+inline typename ListView<T, Tr>::const_iterator
+ListView<T, Tr>::end() const
+{
+  return const_iterator(nullptr);
+}
+
+template <typename T, class Tr>
+inline typename ListView<T, Tr>::size_type
+ListView<T, Tr>::size() const
+{
+  return g_list_length(glist_);
+}
+
+template <typename T, class Tr>
+inline bool
+ListView<T, Tr>::empty() const
+{
+  return !glist_;
+}
+
+template <typename T, class Tr>
+inline typename ListView<T, Tr>::value_type
+ListView<T, Tr>::front() const
+{
+  return *begin();
+}
+
+template <typename T, class Tr>
+inline typename ListView<T, Tr>::VectorType
+ListView<T, Tr>::to_vector() const
+{
+  VectorType vector;
+  vector.reserve(size());
+  for (const_iterator it = begin(); it != end(); ++it)
+    vector.emplace_back(*it);
+  return vector;
+}
+
+template <typename T, class Tr>
+inline ListView<T, Tr>::operator VectorType() const
+{
+  return to_vector();
+}
+
+template <typename T, class Tr>
+inline const GList*
+ListView<T, Tr>::data() const
+{
+  return glist_;
+}
+
+/**** Glib::SListView<> ************************/
+
+template <typename T, class Tr>
+inline SListView<T, Tr>::SListView(GSList* gslist, Glib::OwnershipType ownership)
+: gslist_(gslist), ownership_(ownership)
+{
+}
+
+template <typename T, class Tr>
+inline SListView<T, Tr>::SListView(SListView&& src) noexcept
+: gslist_(src.gslist_), ownership_(src.ownership_)
+{
+  src.gslist_ = nullptr;
+}
+
+template <typename T, class Tr>
+inline SListView<T, Tr>&
+SListView<T, Tr>::operator=(SListView&& src) noexcept
+{
+  if (&src != this)
+  {
+    release();
+    gslist_ = src.gslist_;
+    ownership_ = src.ownership_;
+    src.gslist_ = nullptr;
+  }
+  return *this;
+}
+
+template <typename T, class Tr>
+SListView<T, Tr>::~SListView() noexcept
+{
+  release();
+}
+
+template <typename T, class Tr>
+void
+SListView<T, Tr>::release() noexcept
+{
+  // GSListKeeper frees the list, as specified by the ownership.
+  Glib::Container_Helpers::GSListKeeper<Tr>(gslist_, ownership_);
+  gslist_ = nullptr;
+}
+
+template <typename T, class Tr>
+inline typename SListView<T, Tr>::const_iterator
+SListView<T, Tr>::begin() const
+{
+  return const_iterator(gslist_);
+}
+
+template <typename T, class Tr>
+inline typename SListView<T, Tr>::const_iterator
+SListView<T, Tr>::end() const
+{
+  return const_iterator(nullptr);
+}
+
+template <typename T, class Tr>
+inline typename SListView<T, Tr>::size_type
+SListView<T, Tr>::size() const
+{
+  return g_slist_length(gslist_);
+}
+
+template <typename T, class Tr>
+inline bool
+SListView<T, Tr>::empty() const
+{
+  return !gslist_;
+}
+
+template <typename T, class Tr>
+inline typename SListView<T, Tr>::value_type
+SListView<T, Tr>::front() const
+{
+  return *begin();
+}
+
+template <typename T, class Tr>
+inline typename SListView<T, Tr>::VectorType
+SListView<T, Tr>::to_vector() const
+{
+  VectorType vector;
+  vector.reserve(size());
+  for (const_iterator it = begin(); it != end(); ++it)
+    vector.emplace_back(*it);
+  return vector;
+}
+
+template <typename T, class Tr>
+inline SListView<T, Tr>::operator VectorType() const
+{
+  return to_vector();
+}
+
+template <typename T, class Tr>
+inline const GSList*
+SListView<T, Tr>::data() const
+{
+  return gslist_;
+}
+
 #endif /* DOXYGEN_SHOULD_SKIP_THIS */
 
 } // namespace Glib
@@ -0,0 +1,116 @@
+#include <cstdlib>
+#include <giomm.h>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+// Use this line if you want debug output:
+// std::ostream& ostr = std::cout;
+
+// This seems nicer and more useful than putting an ifdef around the use of ostr:
+std::ostringstream debug;
+std::ostream& ostr = debug;
+
+std::vector<std::string>
+read_lines(const std::string& data, Gio::DataStreamNewlineType newline_type, gsize buffer_size)
+{
+  auto memory_stream = Gio::MemoryInputStream::create();
+  memory_stream->add_data(data.data(), data.size(), nullptr);
+  auto stream = Gio::DataInputStream::create(memory_stream);
+  stream->set_newline_type(newline_type);
+  // A small buffer exercises newlines split between fills, and buffer growth.
+  stream->set_buffer_size(buffer_size);
+
+  std::vector<std::string> result;
+  for (std::string_view line : stream->lines())
+  {
+    ostr << "[" << line << "]" << std::endl;
+    result.emplace_back(line);
+  }
+  return result;
+}
+
+bool
+check(const std::string& name, const std::string& data, Gio::DataStreamNewlineType newline_type,
+  const std::vector<std::string>& expected)
+{
+  for (gsize buffer_size : { 1, 2, 3, 4096 })
+  {
+    const auto lines = read_lines(data, newline_type, buffer_size);
+    if (lines != expected)
+    {
+      std::cerr << name << ", buffer_size=" << buffer_size << ": got " << lines.size()
+                << " lines, expected " << expected.size() << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+
+} // anonymous namespace
+
+int
+main(int, char**)
+{
+  Glib::init();
+  Gio::init();
+
+  bool ok = true;
+  try
+  {
+    const std::string data = "one\ntwo\r\nthree\rfour\n\nsix";
+
+    ok &= check("LF", data, Gio::DataStreamNewlineType::LF,
+      { "one", "two\r", "three\rfour", "", "six" });
+    ok &= check("CR", data, Gio::DataStreamNewlineType::CR,
+      { "one\ntwo", "\nthree", "four\n\nsix" });
+    ok &= check("CR_LF", data, Gio::DataStreamNewlineType::CR_LF,
+      { "one\ntwo", "three\rfour\n\nsix" });
+    ok &= check("ANY", data, Gio::DataStreamNewlineType::ANY,
+      { "one", "two", "three", "four", "", "six" });
+
+    // A trailing newline does not produce an empty last line.
+    ok &= check("ANY, trailing CR", "a\rb\r", Gio::DataStreamNewlineType::ANY, { "a", "b" });
+    ok &= check("LF, empty", "", Gio::DataStreamNewlineType::LF, {});
+
+    // Invalid UTF-8 is reported only if requested.
+    const std::string invalid_data = "ok\n\xff\xfe\nok again\n";
+    auto memory_stream = Gio::MemoryInputStream::create();
+    memory_stream->add_data(invalid_data.data(), invalid_data.size(), nullptr);
+    auto stream = Gio::DataInputStream::create(memory_stream);
+    int n_lines = 0;
+    int n_errors = 0;
+    auto range = stream->lines({}, true);
+    auto it = range.begin();
+    while (it != range.end())
+    {
+      ++n_lines;
+      try
+      {
+        ++it;
+      }
+      catch (const Glib::ConvertError& ex)
+      {
+        ostr << "ConvertError: " << ex.what() << std::endl;
+        ++n_errors;
+        ++it;
+      }
+    }
+    if (n_lines != 2 || n_errors != 1)
+    {
+      std::cerr << "UTF-8 validation: n_lines=" << n_lines << ", n_errors=" << n_errors
+                << std::endl;
+      ok = false;
+    }
+  }
+  catch (const Glib::Error& ex)
+  {
+    std::cerr << "Exception caught: " << ex.what() << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,166 @@
+#include <cstdlib>
+#include <giomm.h>
+#include <iostream>
+#include <set>
+#include <sstream>
+#include <string>
+
+namespace
+{
+// Use this line if you want debug output:
+// std::ostream& ostr = std::cout;
+
+// This seems nicer and more useful than putting an ifdef around the use of ostr:
+std::ostringstream debug;
+std::ostream& ostr = debug;
+
+// root/
+//   a/
+//     f1
+//     f2
+//     c/
+//       f3
+//   b/
+//     f4
+//   f5
+void
+create_tree(const std::string& root)
+{
+  for (const auto& dir : { "a", "b", "a/c" })
+    Gio::File::create_for_path(Glib::build_filename(root, dir))->make_directory();
+  for (const auto& file : { "a/f1", "a/f2", "a/c/f3", "b/f4", "f5" })
+    Glib::file_set_contents(Glib::build_filename(root, file), file);
+}
+
+void
+delete_tree(const Glib::RefPtr<Gio::File>& dir)
+{
+  auto enumerator = dir->enumerate_children("standard::name,standard::type",
+    Gio::FileQueryInfoFlags::NOFOLLOW_SYMLINKS);
+  while (auto info = enumerator->next_file())
+  {
+    auto child = enumerator->get_child(info);
+    if (info->get_file_type() == Gio::FileType::DIRECTORY)
+      delete_tree(child);
+    else
+      child->remove();
+  }
+  enumerator->close();
+  dir->remove();
+}
+
+struct WalkResult
+{
+  std::set<std::string> names;
+  unsigned int n_entries = 0;
+  unsigned int n_directories = 0;
+  unsigned int n_errors = 0;
+};
+
+WalkResult
+walk(const Glib::RefPtr<Gio::File>& root, int max_depth, bool pause_once)
+{
+  WalkResult result;
+  auto mainloop = Glib::MainLoop::create();
+
+  Gio::DirectoryWalker walker("standard::size");
+  walker.set_max_parallel(2);
+  walker.set_batch_size(2);
+  walker.set_max_depth(max_depth);
+
+  walker.signal_directory_done().connect(
+    [&result](const Gio::DirectoryWalker::DirectoryStats& stats)
+    {
+      ++result.n_directories;
+      ostr << stats.directory->get_path() << ": " << stats.n_entries << " entries, "
+           << stats.n_batches << " batches, " << stats.elapsed_usec << " us" << std::endl;
+    });
+  walker.signal_error().connect(
+    [&result](const Glib::RefPtr<Gio::File>& dir, const Glib::Error& error)
+    {
+      ++result.n_errors;
+      std::cerr << dir->get_path() << ": " << error.what() << std::endl;
+    });
+
+  bool paused = false;
+  walker.walk_async(root,
+    [&](const Glib::RefPtr<Gio::File>&, const std::vector<Glib::RefPtr<Gio::FileInfo>>& infos)
+    {
+      for (const auto& info : infos)
+      {
+        result.names.insert(info->get_name());
+        ++result.n_entries;
+      }
+      if (pause_once && !paused)
+      {
+        paused = true;
+        walker.pause();
+        Glib::signal_idle().connect_once([&walker]() { walker.resume(); });
+      }
+    },
+    [&mainloop]() { mainloop->quit(); });
+
+  mainloop->run();
+  return result;
+}
+
+} // anonymous namespace
+
+int
+main(int, char**)
+{
+  Glib::init();
+  Gio::init();
+
+  gchar* tmp_dir = g_dir_make_tmp("giomm_directorywalker_XXXXXX", nullptr);
+  if (!tmp_dir)
+  {
+    std::cerr << "Could not create a temporary directory." << std::endl;
+    return EXIT_FAILURE;
+  }
+  const std::string root_path = tmp_dir;
+  g_free(tmp_dir);
+  auto root = Gio::File::create_for_path(root_path);
+
+  int exit_code = EXIT_SUCCESS;
+  try
+  {
+    create_tree(root_path);
+
+    auto result = walk(root, -1, false);
+    const std::set<std::string> all_names = { "a", "b", "c", "f1", "f2", "f3", "f4", "f5" };
+    if (result.n_entries != 8 || result.n_directories != 4 || result.n_errors != 0 ||
+        result.names != all_names)
+    {
+      std::cerr << "Unlimited walk: entries=" << result.n_entries
+                << " directories=" << result.n_directories << std::endl;
+      exit_code = EXIT_FAILURE;
+    }
+
+    result = walk(root, 0, false);
+    const std::set<std::string> top_names = { "a", "b", "f5" };
+    if (result.n_entries != 3 || result.n_directories != 1 || result.names != top_names)
+    {
+      std::cerr << "Walk with max_depth=0: entries=" << result.n_entries
+                << " directories=" << result.n_directories << std::endl;
+      exit_code = EXIT_FAILURE;
+    }
+
+    result = walk(root, -1, true);
+    if (result.n_entries != 8 || result.n_directories != 4)
+    {
+      std::cerr << "Paused walk: entries=" << result.n_entries
+                << " directories=" << result.n_directories << std::endl;
+      exit_code = EXIT_FAILURE;
+    }
+
+    delete_tree(root);
+  }
+  catch (const Glib::Error& ex)
+  {
+    std::cerr << "Exception caught: " << ex.what() << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return exit_code;
+}
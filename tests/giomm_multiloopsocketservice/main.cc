@@ -0,0 +1,155 @@
+/* Copyright (C) 2026 The giomm Development Team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <giomm.h>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+namespace
+{
+
+constexpr unsigned int n_loops = 3;
+constexpr unsigned int n_connections = 30;
+
+} // anonymous namespace
+
+int
+main(int, char**)
+{
+  Gio::init();
+
+  bool ok = true;
+  Gio::MultiLoopSocketService service(n_loops);
+  if (service.get_n_loops() != n_loops)
+  {
+    std::cerr << "Number of loops: " << service.get_n_loops() << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  guint16 port = 0;
+  try
+  {
+    port = service.add_inet_port(0);
+  }
+  catch (const Glib::Error& error)
+  {
+    std::cerr << "Can't listen on a TCP port: " << error.what() << std::endl;
+    return 77; // Skip
+  }
+
+  std::vector<Glib::RefPtr<Glib::MainContext>> contexts;
+  for (unsigned int i = 0; i < n_loops; ++i)
+    contexts.push_back(service.get_context(i));
+
+  const auto main_thread_id = std::this_thread::get_id();
+  std::mutex mutex;
+  std::set<GMainContext*> used_contexts;
+  std::atomic<unsigned int> n_incoming{0};
+  std::atomic<unsigned int> n_wrong_thread{0};
+
+  service.start(
+    [&](const Glib::RefPtr<Gio::SocketConnection>&, const Glib::RefPtr<Glib::Object>&) -> bool
+    {
+      // The slot runs in a worker thread, with that worker's context
+      // as the thread-default context.
+      const auto context = Glib::MainContext::get_thread_default();
+      bool is_worker_context = false;
+      for (const auto& worker_context : contexts)
+        if (context && context->gobj() == worker_context->gobj())
+          is_worker_context = true;
+      if (!is_worker_context || std::this_thread::get_id() == main_thread_id)
+        ++n_wrong_thread;
+
+      if (context)
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        used_contexts.insert(context->gobj());
+      }
+      ++n_incoming;
+      return true;
+    });
+
+  if (!service.is_running())
+  {
+    std::cerr << "The service is not running." << std::endl;
+    ok = false;
+  }
+
+  // Keep the client connections open until all of them have been handled.
+  auto client = Gio::SocketClient::create();
+  std::vector<Glib::RefPtr<Gio::SocketConnection>> connections;
+  try
+  {
+    for (unsigned int i = 0; i < n_connections; ++i)
+      connections.push_back(client->connect_to_host("localhost", port));
+  }
+  catch (const Glib::Error& error)
+  {
+    std::cerr << "Can't connect to the service: " << error.what() << std::endl;
+    return 77; // Skip
+  }
+
+  const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+  while (n_incoming < n_connections && std::chrono::steady_clock::now() < deadline)
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+  if (n_incoming != n_connections)
+  {
+    std::cerr << "Incoming connections: " << n_incoming << " of " << n_connections << std::endl;
+    ok = false;
+  }
+  if (n_wrong_thread != 0)
+  {
+    std::cerr << n_wrong_thread
+              << " connections were not handled in a worker's thread and context." << std::endl;
+    ok = false;
+  }
+  // Without per-loop listeners the connections are handed round-robin to the loops.
+  // With them the kernel distributes the connections, usually also to all loops.
+  if (!Gio::MultiLoopSocketService::has_per_loop_listeners() &&
+      used_contexts.size() != n_loops)
+  {
+    std::cerr << "Connections were handled in " << used_contexts.size() << " of " << n_loops
+              << " loops." << std::endl;
+    ok = false;
+  }
+
+  service.stop();
+  if (service.is_running())
+  {
+    std::cerr << "The service is still running." << std::endl;
+    ok = false;
+  }
+
+  // The counters are complete when the loops have been stopped.
+  guint64 n_accepted = 0;
+  for (unsigned int i = 0; i < n_loops; ++i)
+    n_accepted += service.get_loop_stats(i).accepted;
+  if (n_accepted != n_connections)
+  {
+    std::cerr << "Accepted connections in the loop stats: " << n_accepted << std::endl;
+    ok = false;
+  }
+
+  return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
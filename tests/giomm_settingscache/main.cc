@@ -0,0 +1,185 @@
+/* Copyright (C) 2026 The giomm Development Team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <giomm.h>
+#include <glib/gstdio.h>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+const char schema_xml[] =
+  "<schemalist>"
+  "  <enum id='org.gtkmm.test.settingscache.Mode'>"
+  "    <value nick='off' value='0'/>"
+  "    <value nick='fast' value='1'/>"
+  "    <value nick='slow' value='2'/>"
+  "  </enum>"
+  "  <flags id='org.gtkmm.test.settingscache.Options'>"
+  "    <value nick='bold' value='1'/>"
+  "    <value nick='italic' value='2'/>"
+  "  </flags>"
+  "  <schema id='org.gtkmm.test.settingscache'>"
+  "    <key name='enabled' type='b'><default>true</default></key>"
+  "    <key name='count' type='i'><default>42</default></key>"
+  "    <key name='size' type='t'><default>12345678901</default></key>"
+  "    <key name='ratio' type='d'><default>0.5</default></key>"
+  "    <key name='title' type='s'><default>'hello'</default></key>"
+  "    <key name='names' type='as'><default>['a', 'b']</default></key>"
+  "    <key name='mode' enum='org.gtkmm.test.settingscache.Mode'><default>'fast'</default></key>"
+  "    <key name='options' flags='org.gtkmm.test.settingscache.Options'>"
+  "      <default>['italic']</default></key>"
+  "    <key name='point' type='(ii)'><default>(1, 2)</default></key>"
+  "  </schema>"
+  "</schemalist>";
+
+bool ok = true;
+
+template <typename T>
+void
+check(const char* what, const T& value, const T& expected)
+{
+  if (!(value == expected))
+  {
+    std::cerr << what << ": " << value << " != " << expected << std::endl;
+    ok = false;
+  }
+}
+
+// Compiles the schema into @a dir. Returns false if glib-compile-schemas
+// can't be run.
+bool
+compile_schema(const std::string& dir)
+{
+  Glib::file_set_contents(
+    Glib::build_filename(dir, "org.gtkmm.test.settingscache.gschema.xml"), schema_xml);
+  try
+  {
+    int wait_status = 0;
+    Glib::spawn_sync(
+      "", { "glib-compile-schemas", dir }, Glib::SpawnFlags::SEARCH_PATH, {}, nullptr, nullptr,
+      &wait_status);
+    return g_spawn_check_wait_status(wait_status, nullptr);
+  }
+  catch (const Glib::SpawnError& error)
+  {
+    std::cerr << "Can't run glib-compile-schemas: " << error.what() << std::endl;
+    return false;
+  }
+}
+
+void
+remove_schema_dir(const std::string& dir)
+{
+  g_remove(Glib::build_filename(dir, "org.gtkmm.test.settingscache.gschema.xml").c_str());
+  g_remove(Glib::build_filename(dir, "gschemas.compiled").c_str());
+  g_rmdir(dir.c_str());
+}
+
+void
+iterate_main_context()
+{
+  auto context = Glib::MainContext::get_default();
+  while (context->iteration(false))
+  {
+  }
+}
+
+} // anonymous namespace
+
+int
+main(int, char**)
+{
+  Gio::init();
+
+  char* const tmp = g_dir_make_tmp("giomm-settingscache-XXXXXX", nullptr);
+  if (!tmp)
+    return 77; // Skip
+  const std::string dir = tmp;
+  g_free(tmp);
+
+  if (!compile_schema(dir))
+  {
+    remove_schema_dir(dir);
+    return 77; // Skip
+  }
+
+  Glib::setenv("GSETTINGS_SCHEMA_DIR", dir);
+  Glib::setenv("GSETTINGS_BACKEND", "memory");
+
+  {
+    auto settings = Gio::Settings::create("org.gtkmm.test.settingscache");
+    Gio::SettingsCache cache(settings);
+
+    check("number of keys", cache.get_keys().size(), std::size_t(9));
+    check("unknown key", cache.find_key("no-such-key"), Gio::SettingsCache::invalid_key);
+
+    const auto count = cache.find_key("count");
+    const auto title = cache.find_key("title");
+    const auto mode = cache.find_key("mode");
+    if (count == Gio::SettingsCache::invalid_key || title == Gio::SettingsCache::invalid_key ||
+        mode == Gio::SettingsCache::invalid_key)
+    {
+      std::cerr << "find_key() failed." << std::endl;
+      remove_schema_dir(dir);
+      return EXIT_FAILURE;
+    }
+    check("key name", cache.get_keys()[count], Glib::ustring("count"));
+
+    // Default values.
+    check("enabled", cache.get_boolean("enabled"), true);
+    check("count", cache.get_int(count), 42);
+    check("size", cache.get_uint64("size"), guint64(12345678901));
+    check("ratio", cache.get_double("ratio"), 0.5);
+    check("title", cache.get_string(title), Glib::ustring("hello"));
+    check("names", cache.get_string_array("names").size(), std::size_t(2));
+    check("mode", cache.get_enum(mode), 1);
+    check("mode nick", cache.get_string(mode), Glib::ustring("fast"));
+    check("options", cache.get_flags("options"), guint(2));
+    check("point", cache.get_value("point").print(), Glib::ustring("(1, 2)"));
+
+    std::vector<Gio::SettingsCache::Key> changed;
+    cache.signal_changed().connect(
+      [&changed](Gio::SettingsCache::Key key) { changed.push_back(key); });
+
+    // Changes are read when Settings::signal_changed() is emitted.
+    settings->set_int("count", 7);
+    settings->set_string("title", "world");
+    settings->set_enum("mode", 2);
+    iterate_main_context();
+
+    check("changed count", cache.get_int(count), 7);
+    check("changed title", cache.get_string(title), Glib::ustring("world"));
+    check("changed mode", cache.get_enum(mode), 2);
+    check("changed mode nick", cache.get_string(mode), Glib::ustring("slow"));
+    check("number of changed keys", changed.size(), std::size_t(3));
+
+    // The other keys are unchanged.
+    check("unchanged enabled", cache.get_boolean("enabled"), true);
+    check("unchanged ratio", cache.get_double("ratio"), 0.5);
+
+    settings->reset("count");
+    iterate_main_context();
+    check("reset count", cache.get_int(count), 42);
+  }
+
+  remove_schema_dir(dir);
+
+  return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
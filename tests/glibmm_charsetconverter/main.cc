@@ -0,0 +1,150 @@
+/* Copyright (C) 2026 The glibmm Development Team
+ *
+ * This file is part of glibmm.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <cstdlib> // EXIT_SUCCESS, EXIT_FAILURE
+#include <glibmm.h>
+#include <iostream>
+#include <string>
+
+namespace
+{
+
+// Converts text in chunks of chunk_size bytes, with both convert() overloads.
+bool
+check_conversion(const std::string& text, const std::string& to_codeset,
+  const std::string& from_codeset)
+{
+  const std::string source = Glib::convert(text, from_codeset, "UTF-8");
+  const std::string expected = Glib::convert(source, to_codeset, from_codeset);
+
+  bool ok = true;
+  Glib::CharsetConverter converter(to_codeset, from_codeset);
+  for (std::size_t chunk_size : { 1, 2, 3, 7, 4096 })
+  {
+    std::string output;
+    for (std::size_t pos = 0; pos < source.size(); pos += chunk_size)
+      converter.convert(std::string_view(source).substr(pos, chunk_size), output);
+    converter.finish(output);
+
+    std::string buffer_output;
+    char buffer[16];
+    for (std::size_t pos = 0; pos < source.size(); pos += chunk_size)
+    {
+      auto input = std::string_view(source).substr(pos, chunk_size);
+      while (!input.empty())
+      {
+        gsize bytes_read = 0;
+        const gsize bytes_written = converter.convert(input, buffer, sizeof(buffer), bytes_read);
+        buffer_output.append(buffer, bytes_written);
+        input.remove_prefix(bytes_read);
+      }
+    }
+    converter.finish(buffer_output);
+
+    if (output != expected || buffer_output != expected)
+    {
+      std::cerr << from_codeset << " to " << to_codeset << ", chunk size " << chunk_size
+                << ": Unexpected output." << std::endl;
+      ok = false;
+    }
+  }
+  return ok;
+}
+
+} // anonymous namespace
+
+int
+main(int, char**)
+{
+  Glib::init();
+
+  bool ok = true;
+  std::string text;
+  for (int i = 0; i < 100; ++i)
+    text += "A long run of ASCII characters. Café, naïve, üöä €. ";
+
+  ok &= check_conversion(text, "UTF-8", "CP1252");
+  ok &= check_conversion(text, "CP1252", "UTF-8");
+  ok &= check_conversion(text, "UTF-8", "UTF-8");
+  ok &= check_conversion(text, "UTF-16LE", "UTF-8");
+  ok &= check_conversion("日本語 abc あい", "UTF-8", "EUC-JP");
+
+  // glibc's converter from CP1258 holds back a base character until the next
+  // character, which may be a combining character. The ASCII characters after
+  // it must not overtake it.
+  std::string cp1258_text = "Ă";
+  for (int i = 0; i < 10; ++i)
+    cp1258_text += "A long run of ASCII characters after a non-ASCII character. ";
+  ok &= check_conversion(cp1258_text, "UTF-8", "CP1258");
+
+  if (!Glib::CharsetConverter("UTF-8", "ISO-8859-15").has_ascii_fast_path() ||
+      Glib::CharsetConverter("UTF-8", "UTF-16LE").has_ascii_fast_path() ||
+      Glib::CharsetConverter("UTF-8", "CP1258").has_ascii_fast_path())
+  {
+    std::cerr << "Wrong has_ascii_fast_path()." << std::endl;
+    ok = false;
+  }
+
+  // An incomplete character at the end of the input.
+  Glib::CharsetConverter converter("UTF-8", "UTF-8");
+  std::string output;
+  try
+  {
+    converter.convert("ab\xc3", output);
+    converter.finish(output);
+    std::cerr << "No exception for partial input." << std::endl;
+    ok = false;
+  }
+  catch (const Glib::ConvertError& error)
+  {
+    if (error.code() != Glib::ConvertError::PARTIAL_INPUT || output != "ab")
+      ok = false;
+  }
+
+  // An invalid character. The text before it is kept.
+  output.clear();
+  try
+  {
+    converter.convert("ab\xc3(cdefghijklmnopqrstuvwxyz", output);
+    std::cerr << "No exception for an invalid character." << std::endl;
+    ok = false;
+  }
+  catch (const Glib::ConvertError& error)
+  {
+    if (error.code() != Glib::ConvertError::ILLEGAL_SEQUENCE || output != "ab")
+      ok = false;
+  }
+  converter.reset();
+  output.clear();
+  converter.convert("ok", output);
+  if (output != "ok")
+    ok = false;
+
+  try
+  {
+    Glib::CharsetConverter invalid("UTF-8", "NO-SUCH-CHARSET");
+    std::cerr << "No exception for an unknown codeset." << std::endl;
+    ok = false;
+  }
+  catch (const Glib::ConvertError&)
+  {
+  }
+
+  return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,197 @@
+/* Copyright (C) 2026 The glibmm Development Team
+ *
+ * This file is part of glibmm.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <glibmm.h>
+#include <glibmm/private/object_p.h>
+#include <cstdlib> // EXIT_SUCCESS, EXIT_FAILURE
+#include <cstring>
+#include <iostream>
+#include <string>
+
+// A C type with construct properties.
+typedef struct
+{
+  GObject parent;
+  int number;
+  char* label;
+  gboolean flag;
+  double ratio;
+  GObject* child;
+} TestProps;
+
+typedef struct
+{
+  GObjectClass parent;
+} TestPropsClass;
+
+enum
+{
+  PROP_0,
+  PROP_NUMBER,
+  PROP_LABEL,
+  PROP_FLAG,
+  PROP_RATIO,
+  PROP_CHILD
+};
+
+G_DEFINE_TYPE(TestProps, test_props, G_TYPE_OBJECT)
+
+static void
+test_props_init(TestProps*)
+{
+}
+
+static void
+test_props_finalize(GObject* gobject)
+{
+  auto self = reinterpret_cast<TestProps*>(gobject);
+  g_free(self->label);
+  g_clear_object(&self->child);
+  G_OBJECT_CLASS(test_props_parent_class)->finalize(gobject);
+}
+
+static void
+test_props_set_property(GObject* gobject, guint prop_id, const GValue* value, GParamSpec*)
+{
+  auto self = reinterpret_cast<TestProps*>(gobject);
+  switch (prop_id)
+  {
+  case PROP_NUMBER:
+    self->number = g_value_get_int(value);
+    break;
+  case PROP_LABEL:
+    g_free(self->label);
+    self->label = g_value_dup_string(value);
+    break;
+  case PROP_FLAG:
+    self->flag = g_value_get_boolean(value);
+    break;
+  case PROP_RATIO:
+    self->ratio = g_value_get_double(value);
+    break;
+  case PROP_CHILD:
+    g_clear_object(&self->child);
+    self->child = G_OBJECT(g_value_dup_object(value));
+    break;
+  }
+}
+
+static void
+test_props_get_property(GObject*, guint, GValue*, GParamSpec*)
+{
+}
+
+static void
+test_props_class_init(TestPropsClass* klass)
+{
+  auto gobject_class = G_OBJECT_CLASS(klass);
+  gobject_class->finalize = &test_props_finalize;
+  gobject_class->set_property = &test_props_set_property;
+  gobject_class->get_property = &test_props_get_property;
+
+  const auto flags = GParamFlags(G_PARAM_READWRITE | G_PARAM_CONSTRUCT_ONLY);
+  g_object_class_install_property(gobject_class, PROP_NUMBER,
+    g_param_spec_int("number", nullptr, nullptr, G_MININT, G_MAXINT, 0, flags));
+  g_object_class_install_property(gobject_class, PROP_LABEL,
+    g_param_spec_string("label", nullptr, nullptr, nullptr, flags));
+  g_object_class_install_property(gobject_class, PROP_FLAG,
+    g_param_spec_boolean("flag", nullptr, nullptr, false, flags));
+  g_object_class_install_property(gobject_class, PROP_RATIO,
+    g_param_spec_double("ratio", nullptr, nullptr, 0.0, 1.0, 0.0, flags));
+  g_object_class_install_property(gobject_class, PROP_CHILD,
+    g_param_spec_object("child", nullptr, nullptr, G_TYPE_OBJECT, flags));
+}
+
+class PropsObject_Class : public Glib::Class
+{
+public:
+  static void class_init_function(void* g_class, void* class_data)
+  {
+    Glib::Object_Class::class_init_function(g_class, class_data);
+  }
+
+  const Glib::Class& init()
+  {
+    if (!gtype_)
+    {
+      class_init_func_ = &PropsObject_Class::class_init_function;
+      register_derived_type(test_props_get_type());
+    }
+    return *this;
+  }
+};
+
+class PropsObject : public Glib::Object
+{
+public:
+  PropsObject(int number, const std::string& label, GObject* child)
+  : Glib::ObjectBase(nullptr),
+    Glib::Object(Glib::StackConstructParams(props_object_class_.init(),
+      "number", number, "label", label, "flag", true, "ratio", 0.5f, "child", child))
+  {
+  }
+
+  // Like a constructor generated by gmmproc.
+  explicit PropsObject(int number)
+  : Glib::ObjectBase(nullptr),
+    Glib::Object(Glib::ConstructParams(props_object_class_.init(),
+      "number", number, "label", "varargs", nullptr))
+  {
+  }
+
+  const TestProps* get_props() const { return reinterpret_cast<const TestProps*>(gobj()); }
+
+private:
+  static PropsObject_Class props_object_class_;
+};
+
+PropsObject_Class PropsObject::props_object_class_;
+
+int
+main(int, char**)
+{
+  Glib::init();
+
+  bool ok = true;
+  GObject* const child = G_OBJECT(g_object_new(G_TYPE_OBJECT, nullptr));
+
+  for (int i = 0; i < 3; ++i) // The GParamSpecs are cached after the first construction.
+  {
+    PropsObject object(42 + i, "stack", child);
+    const TestProps* const props = object.get_props();
+    if (props->number != 42 + i || std::strcmp(props->label, "stack") != 0 || !props->flag ||
+        props->ratio != 0.5 || props->child != child)
+    {
+      std::cerr << "StackConstructParams: Unexpected property values." << std::endl;
+      ok = false;
+    }
+  }
+
+  {
+    PropsObject object(7);
+    const TestProps* const props = object.get_props();
+    if (props->number != 7 || std::strcmp(props->label, "varargs") != 0 || props->child)
+    {
+      std::cerr << "ConstructParams: Unexpected property values." << std::endl;
+      ok = false;
+    }
+  }
+
+  g_object_unref(child);
+  return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
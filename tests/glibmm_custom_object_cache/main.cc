@@ -0,0 +1,131 @@
+/* Copyright (C) 2026 The glibmm Development Team
+ *
+ * This file is part of glibmm.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <glibmm.h>
+#include <cstdlib> // EXIT_SUCCESS, EXIT_FAILURE
+#include <iostream>
+#include <string>
+#include <vector>
+
+// The custom types and the GParamSpecs of the custom properties are cached
+// per thread. Objects of two custom types, created alternately, must get
+// the right type and properties.
+
+namespace
+{
+
+class Point : public Glib::Object
+{
+public:
+  Point()
+  : Glib::ObjectBase("CustomObjectCachePoint"),
+    x_(*this, "x", 0),
+    label_(*this, "label", "")
+  {
+  }
+
+  Glib::PropertyProxy<int> property_x() { return x_.get_proxy(); }
+  Glib::PropertyProxy<Glib::ustring> property_label() { return label_.get_proxy(); }
+
+private:
+  Glib::Property<int> x_;
+  Glib::Property<Glib::ustring> label_;
+};
+
+// Same property names in another order, and of other types.
+class Item : public Glib::Object
+{
+public:
+  Item()
+  : Glib::ObjectBase("CustomObjectCacheItem"),
+    label_(*this, "label", 0.0),
+    x_(*this, "x", false)
+  {
+  }
+
+  Glib::PropertyProxy<double> property_label() { return label_.get_proxy(); }
+  Glib::PropertyProxy<bool> property_x() { return x_.get_proxy(); }
+
+private:
+  Glib::Property<double> label_;
+  Glib::Property<bool> x_;
+};
+
+} // anonymous namespace
+
+int
+main(int, char**)
+{
+  Glib::init();
+
+  bool ok = true;
+  const int n = 1000;
+  std::vector<Glib::RefPtr<Point>> points;
+  std::vector<Glib::RefPtr<Item>> items;
+  for (int i = 0; i < n; ++i)
+  {
+    points.push_back(Glib::make_refptr_for_instance<Point>(new Point()));
+    points.back()->property_x() = i;
+    points.back()->property_label() = std::to_string(i);
+
+    items.push_back(Glib::make_refptr_for_instance<Item>(new Item()));
+    items.back()->property_label() = i + 0.5;
+    items.back()->property_x() = i % 2 == 1;
+  }
+
+  const GType point_type = G_OBJECT_TYPE(points.front()->gobj());
+  const GType item_type = G_OBJECT_TYPE(items.front()->gobj());
+  if (point_type == item_type)
+  {
+    std::cerr << "Point and Item have the same type." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  for (int i = 0; i < n; ++i)
+  {
+    if (G_OBJECT_TYPE(points[i]->gobj()) != point_type ||
+        G_OBJECT_TYPE(items[i]->gobj()) != item_type)
+    {
+      std::cerr << "Object " << i << " has the wrong type." << std::endl;
+      ok = false;
+    }
+
+    // Read the values through GObject, to check the installed properties.
+    int x = -1;
+    gchar* label = nullptr;
+    g_object_get(points[i]->gobj(), "x", &x, "label", &label, nullptr);
+    if (x != i || !label || std::to_string(i) != label)
+    {
+      std::cerr << "Point " << i << ": x=" << x << ", label=" << (label ? label : "(null)")
+                << std::endl;
+      ok = false;
+    }
+    g_free(label);
+
+    double item_label = 0.0;
+    gboolean item_x = false;
+    g_object_get(items[i]->gobj(), "label", &item_label, "x", &item_x, nullptr);
+    if (item_label != i + 0.5 || bool(item_x) != (i % 2 == 1))
+    {
+      std::cerr << "Item " << i << ": label=" << item_label << ", x=" << item_x << std::endl;
+      ok = false;
+    }
+  }
+
+  return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,114 @@
+/* Copyright (C) 2026 The glibmm Development Team
+ *
+ * This file is part of glibmm.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <glibmm.h>
+#include <cstdlib> // EXIT_SUCCESS, EXIT_FAILURE
+#include <iostream>
+#include <string>
+
+namespace
+{
+
+void
+timed_function()
+{
+  GLIBMM_SCOPE_TIMER("glibmm-test-timed-function");
+  Glib::usleep(100);
+}
+
+} // anonymous namespace
+
+int
+main(int, char**)
+{
+  Glib::init();
+
+  bool ok = true;
+
+  {
+    Glib::StopWatch stopwatch;
+    Glib::usleep(1000);
+    const gint64 lap = stopwatch.lap_ns();
+    if (lap < 1000000 || stopwatch.elapsed_ns() > lap)
+    {
+      std::cerr << "StopWatch: Unexpected lap time " << lap << " ns" << std::endl;
+      ok = false;
+    }
+  }
+
+  {
+    Glib::LatencyHistogram histogram("test");
+    for (gint64 duration : { 0, 1, 2, 3, 1000, 1000, 1000, 1000, 1000, 5000 })
+      histogram.record(duration);
+
+    const auto snapshot = histogram.get_snapshot();
+    if (snapshot.count != 10 || snapshot.total_ns != 10006 || snapshot.min_ns != 0 ||
+        snapshot.max_ns != 5000)
+    {
+      std::cerr << "LatencyHistogram: Unexpected snapshot " << histogram.to_string() << std::endl;
+      ok = false;
+    }
+    // 1, 2 and 3 ns go to buckets 1, 2 and 2, 1000 ns to bucket 10 ([512, 1024)).
+    if (snapshot.buckets[0] != 1 || snapshot.buckets[1] != 1 || snapshot.buckets[2] != 2 ||
+        snapshot.buckets[10] != 5 || snapshot.buckets[13] != 1)
+    {
+      std::cerr << "LatencyHistogram: Unexpected buckets" << std::endl;
+      ok = false;
+    }
+    if (snapshot.get_percentile_ns(50.0) != 1023 || snapshot.get_percentile_ns(100.0) != 5000)
+    {
+      std::cerr << "LatencyHistogram: Unexpected percentiles" << std::endl;
+      ok = false;
+    }
+
+    histogram.reset();
+    if (histogram.get_snapshot().count != 0)
+    {
+      std::cerr << "LatencyHistogram: reset() failed" << std::endl;
+      ok = false;
+    }
+  }
+
+  for (int i = 0; i < 5; ++i)
+    timed_function();
+
+  auto& registered = Glib::LatencyHistogram::get("glibmm-test-timed-function");
+  const auto snapshot = registered.get_snapshot();
+  if (snapshot.count != 5 || snapshot.min_ns < 100000)
+  {
+    std::cerr << "GLIBMM_SCOPE_TIMER: Unexpected result " << registered.to_string() << std::endl;
+    ok = false;
+  }
+
+  // dump_periodically() reports all registered histograms from the main loop.
+  auto mainloop = Glib::MainLoop::create();
+  std::string dump;
+  Glib::LatencyHistogram::dump_periodically(1, [&](const std::string& text)
+    {
+      dump = text;
+      mainloop->quit();
+    });
+  mainloop->run();
+  if (dump.find("glibmm-test-timed-function: count=5 ") == std::string::npos)
+  {
+    std::cerr << "Unexpected dump: " << dump << std::endl;
+    ok = false;
+  }
+
+  return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,124 @@
+/* Copyright (C) 2026 The glibmm Development Team
+ *
+ * This file is part of glibmm.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <glibmm.h>
+#include <cstdlib> // EXIT_SUCCESS, EXIT_FAILURE
+#include <iostream>
+#include <string>
+
+namespace
+{
+
+const Glib::MainContext::SourceStats*
+find_stats(const std::vector<Glib::MainContext::SourceStats>& all_stats, const std::string& name)
+{
+  for (const auto& stats : all_stats)
+    if (stats.name == name)
+      return &stats;
+  return nullptr;
+}
+
+} // anonymous namespace
+
+int
+main(int, char**)
+{
+  Glib::init();
+
+  bool ok = true;
+  auto context = Glib::MainContext::create();
+  auto mainloop = Glib::MainLoop::create(context);
+
+  context->enable_instrumentation();
+  if (!context->is_instrumentation_enabled())
+  {
+    std::cerr << "is_instrumentation_enabled() returned false." << std::endl;
+    ok = false;
+  }
+
+  context->signal_timeout().connect_once([]() { Glib::usleep(2000); }, 10);
+  context->signal_idle().connect_once([]() {});
+
+  auto source = Glib::IdleSource::create();
+  source->set_name("named idle");
+  source->connect([]() { return false; });
+  source->attach(context);
+
+  // The context is neither owned nor the thread-default context of this
+  // thread, so invoke() adds an idle source.
+  context->invoke([]() { return false; });
+
+  context->signal_timeout().connect_once([mainloop]() { mainloop->quit(); }, 50);
+  mainloop->run();
+
+  const auto all_stats = context->get_source_stats();
+  const auto timeout_stats = find_stats(all_stats, "Glib::SignalTimeout");
+  if (!timeout_stats || timeout_stats->dispatch.count != 2 ||
+      timeout_stats->dispatch.max_ns < 2000000 || timeout_stats->lateness.count != 2)
+  {
+    std::cerr << "Unexpected statistics of Glib::SignalTimeout" << std::endl;
+    ok = false;
+  }
+  const auto idle_stats = find_stats(all_stats, "Glib::SignalIdle");
+  if (!idle_stats || idle_stats->dispatch.count != 1 || idle_stats->lateness.count != 0)
+  {
+    std::cerr << "Unexpected statistics of Glib::SignalIdle" << std::endl;
+    ok = false;
+  }
+  const auto invoke_stats = find_stats(all_stats, "Glib::MainContext::invoke");
+  if (!invoke_stats || invoke_stats->dispatch.count != 1)
+  {
+    std::cerr << "Unexpected statistics of Glib::MainContext::invoke" << std::endl;
+    ok = false;
+  }
+  const auto named_stats = find_stats(all_stats, "named idle");
+  if (!named_stats || named_stats->dispatch.count != 1)
+  {
+    std::cerr << "Unexpected statistics of a named Glib::Source" << std::endl;
+    ok = false;
+  }
+  if (context->get_iteration_stats().count == 0)
+  {
+    std::cerr << "No main loop iterations were recorded." << std::endl;
+    ok = false;
+  }
+
+  const std::string json = context->get_instrumentation_json();
+  if (json.find("\"name\": \"named idle\"") == std::string::npos ||
+      json.find("\"iterations\": {\"count\": ") != 1)
+  {
+    std::cerr << "Unexpected JSON: " << json << std::endl;
+    ok = false;
+  }
+
+  context->reset_instrumentation_stats();
+  if (context->get_iteration_stats().count != 0)
+  {
+    std::cerr << "reset_instrumentation_stats() did not reset." << std::endl;
+    ok = false;
+  }
+
+  context->enable_instrumentation(false);
+  if (context->is_instrumentation_enabled() || !context->get_source_stats().empty())
+  {
+    std::cerr << "The instrumentation was not disabled." << std::endl;
+    ok = false;
+  }
+
+  return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
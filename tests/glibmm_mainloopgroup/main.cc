@@ -0,0 +1,143 @@
+/* Copyright (C) 2026 The glibmm Development Team
+ *
+ * This file is part of glibmm.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib> // EXIT_SUCCESS, EXIT_FAILURE
+#include <glibmm.h>
+#include <iostream>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <thread>
+
+int
+main(int, char**)
+{
+  Glib::init();
+
+  bool ok = true;
+  std::atomic<int> n_done{ 0 };
+  std::atomic<int> n_wrong_context{ 0 };
+  std::atomic<int> n_handled{ 0 };
+  std::mutex mutex;
+  std::set<std::thread::id> thread_ids;
+  const auto main_thread_id = std::this_thread::get_id();
+  {
+    Glib::MainLoopGroup group(3);
+    if (group.get_n_loops() != 3)
+    {
+      std::cerr << "get_n_loops() returned " << group.get_n_loops() << std::endl;
+      ok = false;
+    }
+
+    // Exceptions are handed to the exception handlers of the loops' threads.
+    group.add_exception_handler([&n_handled, main_thread_id]()
+      {
+        try
+        {
+          throw;
+        }
+        catch (const std::runtime_error&)
+        {
+          if (std::this_thread::get_id() != main_thread_id)
+            ++n_handled;
+        }
+      });
+
+    const auto balances = { Glib::MainLoopGroup::Balance::ROUND_ROBIN,
+      Glib::MainLoopGroup::Balance::LEAST_LOADED };
+    for (auto balance : balances)
+      for (int i = 0; i < 300; ++i)
+      {
+        const unsigned int index = group.choose_loop(balance);
+        GMainContext* const context = group.get_context(index)->gobj();
+        group.invoke_in(index, [&, context]()
+          {
+            if (Glib::MainContext::get_thread_default()->gobj() != context)
+              ++n_wrong_context;
+            {
+              std::lock_guard<std::mutex> lock(mutex);
+              thread_ids.insert(std::this_thread::get_id());
+            }
+            ++n_done;
+          });
+      }
+
+    // The loop continues after an exception.
+    group.invoke([]() { throw std::runtime_error("expected"); });
+
+    // Wait for the statistics, which are updated after each slot has returned.
+    guint64 n_executed = 0;
+    guint64 n_pending = 0;
+    guint64 n_exceptions = 0;
+    const gint64 end_time = g_get_monotonic_time() + 10 * G_USEC_PER_SEC;
+    do
+    {
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      n_executed = n_pending = n_exceptions = 0;
+      for (unsigned int i = 0; i < group.get_n_loops(); ++i)
+      {
+        const auto stats = group.get_loop_stats(i);
+        n_executed += stats.n_executed;
+        n_pending += stats.n_pending;
+        n_exceptions += stats.n_exceptions;
+        if (stats.max_latency_usec < 0 || stats.get_mean_latency_usec() > stats.max_latency_usec)
+        {
+          std::cerr << "Inconsistent latencies in loop " << i << std::endl;
+          ok = false;
+        }
+      }
+    } while ((n_executed < 601 || n_pending > 0) && g_get_monotonic_time() < end_time);
+
+    if (n_executed != 601 || n_pending != 0)
+    {
+      std::cerr << "Executed slots: " << n_executed << ", pending slots: " << n_pending
+                << std::endl;
+      ok = false;
+    }
+    if (n_exceptions != 1)
+    {
+      std::cerr << "Exceptions in the loop stats: " << n_exceptions << std::endl;
+      ok = false;
+    }
+  }
+
+  if (n_done != 600)
+  {
+    std::cerr << "Finished slots: " << n_done << std::endl;
+    ok = false;
+  }
+  if (n_handled != 1)
+  {
+    std::cerr << "Exceptions handled in a loop's thread: " << n_handled << std::endl;
+    ok = false;
+  }
+  if (n_wrong_context != 0)
+  {
+    std::cerr << "Slots not executed in their loop's context: " << n_wrong_context << std::endl;
+    ok = false;
+  }
+  if (thread_ids.size() != 3)
+  {
+    std::cerr << "Slots were executed in " << thread_ids.size() << " threads." << std::endl;
+    ok = false;
+  }
+
+  return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
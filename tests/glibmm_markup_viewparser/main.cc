@@ -0,0 +1,144 @@
+/* Copyright (C) 2026 The glibmm Development Team
+ *
+ * This file is part of glibmm.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include <cstdlib> // EXIT_SUCCESS, EXIT_FAILURE
+#include <cstring>
+#include <glibmm.h>
+#include <iostream>
+#include <string>
+
+namespace
+{
+
+const char document[] =
+  "<?xml version=\"1.0\"?>"
+  "<root version=\"2\">"
+  "<item name=\"a\" value=\"1\">text &amp; more</item>"
+  "<item name=\"b\"/>"
+  "<!-- comment -->"
+  "</root>";
+
+class RecordingParser : public Glib::Markup::ViewParser
+{
+public:
+  std::string record;
+
+protected:
+  void on_start_element_view(Glib::Markup::ParseContext&, std::string_view element_name,
+    const Glib::Markup::AttributeView& attributes) override
+  {
+    record += '<';
+    record += element_name;
+    for (const auto& attribute : attributes)
+    {
+      record += ' ';
+      record += attribute.name;
+      record += '=';
+      record += attribute.value;
+    }
+    if (element_name == "item")
+    {
+      record += " value:";
+      record += attributes.get("value", "none");
+      if (attributes.find("valu") || attributes.find("value2"))
+        record += " wrong_find";
+    }
+    if (element_name == "forbidden")
+      throw Glib::MarkupError(Glib::MarkupError::UNKNOWN_ELEMENT, "forbidden");
+    record += '>';
+  }
+
+  void on_end_element_view(Glib::Markup::ParseContext&, std::string_view element_name) override
+  {
+    record += "</";
+    record += element_name;
+    record += '>';
+  }
+
+  void on_text_view(Glib::Markup::ParseContext&, std::string_view text) override
+  {
+    record += text;
+  }
+
+  void on_passthrough_view(Glib::Markup::ParseContext&, std::string_view text) override
+  {
+    record += '[';
+    record += text;
+    record += ']';
+  }
+};
+
+} // anonymous namespace
+
+int
+main(int, char**)
+{
+  Glib::init();
+
+  bool ok = true;
+  const std::string expected =
+    "[<?xml version=\"1.0\"?>]<root version=2>"
+    "<item name=a value=1 value:1>text & more</item>"
+    "<item name=b value:none></item>"
+    "[<!-- comment -->]</root>";
+
+  // Small chunks split names, attributes and entities.
+  for (gsize chunk_size : { 1, 3, 7, 4096 })
+  {
+    RecordingParser parser;
+    Glib::Markup::ParseContext context(parser);
+    std::size_t position = 0;
+    const std::size_t length = std::strlen(document);
+    context.parse_stream([&](char* buffer, gsize count) -> gssize
+      {
+        const std::size_t n = std::min<std::size_t>(count, length - position);
+        std::memcpy(buffer, document + position, n);
+        position += n;
+        return n;
+      }, chunk_size);
+
+    // Text chunks are not necessarily passed in one call, but concatenated
+    // they are the same.
+    if (parser.record != expected)
+    {
+      std::cerr << "Chunk size " << chunk_size << ": " << parser.record << std::endl;
+      ok = false;
+    }
+  }
+
+  // An exception thrown by a callback is reported by parse().
+  {
+    RecordingParser parser;
+    Glib::Markup::ParseContext context(parser);
+    const std::string bad = "<root><forbidden/></root>";
+    try
+    {
+      context.parse(bad.data(), bad.data() + bad.size());
+      std::cerr << "No exception from parse()." << std::endl;
+      ok = false;
+    }
+    catch (const Glib::MarkupError& error)
+    {
+      if (error.code() != Glib::MarkupError::UNKNOWN_ELEMENT)
+        ok = false;
+    }
+  }
+
+  return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
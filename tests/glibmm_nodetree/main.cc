@@ -11,6 +11,17 @@ node_build_string(type_nodetree_string& node, std::string& string)
   return false;
 }
 
+static std::string
+nodes_string(const type_nodetree_string& root, type_nodetree_string::TraverseType order,
+  type_nodetree_string::TraverseFlags flags = type_nodetree_string::TraverseFlags::ALL)
+{
+  std::string string;
+  for (const auto& node : root.nodes(order, flags))
+    string += node.data();
+
+  return string;
+}
+
 int
 main()
 {
@@ -108,6 +119,20 @@ main()
   g_assert(tstring == "ABFG");
   tstring.clear();
 
+  // The iterators visit the nodes in the same order as traverse().
+  g_assert(nodes_string(*root, type_nodetree_string::TraverseType::PRE_ORDER) == "ABCDEFGHIJK");
+  g_assert(nodes_string(*root, type_nodetree_string::TraverseType::POST_ORDER) == "CDEBHIJKGFA");
+  g_assert(nodes_string(*root, type_nodetree_string::TraverseType::IN_ORDER) == "CBDEAHGIJKF");
+  g_assert(nodes_string(*root, type_nodetree_string::TraverseType::LEVEL_ORDER) == "ABFCDEGHIJK");
+  g_assert(nodes_string(*root, type_nodetree_string::TraverseType::LEVEL_ORDER,
+             type_nodetree_string::TraverseFlags::LEAVES) == "CDEHIJK");
+  g_assert(nodes_string(*root, type_nodetree_string::TraverseType::PRE_ORDER,
+             type_nodetree_string::TraverseFlags::NON_LEAVES) == "ABFG");
+  g_assert(nodes_string(*node_G, type_nodetree_string::TraverseType::IN_ORDER) == "HGIJK");
+  g_assert(nodes_string(*node_B, type_nodetree_string::TraverseType::POST_ORDER) == "CDEB");
+  g_assert(root->find_if([](const type_nodetree_string& n) { return n.data() > "I"; },
+             type_nodetree_string::TraverseType::PRE_ORDER) == node_J);
+
   node_B->reverse_children();
   node_G->reverse_children();
 
@@ -146,5 +171,38 @@ main()
 
   delete root;
 
+  /* pool tests */
+
+  {
+    type_nodetree_string::Pool pool(16);
+    root = pool.create("root");
+    node = root;
+    for (guint i = 0; i < 2048; i++)
+    {
+      node->append(*pool.create(std::string(1, 'a' + i % 26)));
+      if ((i % 5) == 4)
+        node = node->first_child()->next_sibling();
+    }
+    // A long level-order traversal, whose visited nodes are dropped from the queue.
+    tstring.clear();
+    root->traverse(sigc::bind(sigc::ptr_fun(node_build_string), std::ref(tstring)),
+      type_nodetree_string::TraverseType::LEVEL_ORDER, type_nodetree_string::TraverseFlags::ALL, -1);
+    g_assert(nodes_string(*root, type_nodetree_string::TraverseType::LEVEL_ORDER) == tstring);
+
+    // Nodes from a pool and other nodes can be mixed.
+    root->append_data("heap");
+    g_assert(pool.get_n_nodes() == 1 + 2048);
+    g_assert(root->node_count(type_nodetree_string::TraverseFlags::ALL) == 1 + 2048 + 1);
+
+    // The class-specific operator new does not hide the nothrow form.
+    root->append(*new (std::nothrow) type_nodetree_string("nothrow"));
+    g_assert(pool.get_n_nodes() == 1 + 2048);
+
+    delete root->first_child();
+    g_assert(pool.get_n_nodes() == 2048);
+    delete root;
+    g_assert(pool.get_n_nodes() == 0);
+  }
+
   return EXIT_SUCCESS;
 }
@@ -0,0 +1,128 @@
+#include <glib.h>
+#include <glibmm/init.h>
+#include <glibmm/object.h>
+#include <glibmm/property.h>
+#include <glibmm/propertyproxy.h>
+#include <vector>
+
+namespace {
+
+struct Point
+{
+  int x = 0;
+  int y = 0;
+};
+
+bool
+operator==(const Point& lhs, const Point& rhs)
+{
+  return lhs.x == rhs.x && lhs.y == rhs.y;
+}
+
+struct NoEquality
+{
+  int x = 0;
+};
+
+// Stored in the GValue. Only the second member differs in the test.
+struct InlineNoEquality
+{
+  gint64 first = 0;
+  gint64 second = 0;
+};
+
+} // namespace
+
+namespace Glib::Traits
+{
+template <> struct ValueInlineStorage<InlineNoEquality> : std::true_type {};
+}
+
+namespace {
+
+static_assert(Glib::Traits::HasEqualityOperator<Point>::value, "");
+static_assert(!Glib::Traits::HasEqualityOperator<NoEquality>::value, "");
+static_assert(!Glib::Traits::HasEqualityOperator<std::vector<NoEquality>>::value, "");
+
+class Model final: public Glib::Object {
+public:
+  Model(): Glib::ObjectBase{"Model"} {}
+
+  Glib::Property<int> count{*this, "count", 0, "", "", Glib::ParamFlags::EXPLICIT_NOTIFY};
+  Glib::Property<Glib::ustring> label{*this, "label", "", "", "", Glib::ParamFlags::EXPLICIT_NOTIFY};
+  Glib::Property<Point> position{*this, "position", Point{}, "", "", Glib::ParamFlags::EXPLICIT_NOTIFY};
+  Glib::Property<InlineNoEquality> pair{*this, "pair", InlineNoEquality{}, "", "",
+    Glib::ParamFlags::EXPLICIT_NOTIFY};
+  Glib::Property<int> always{*this, "always", 0};
+};
+
+void
+test()
+{
+  Glib::init();
+
+  auto model = Model{};
+  int n_count = 0;
+  int n_label = 0;
+  int n_position = 0;
+  int n_pair = 0;
+  int n_always = 0;
+  model.count.get_proxy().signal_changed().connect([&n_count]() { ++n_count; });
+  model.label.get_proxy().signal_changed().connect([&n_label]() { ++n_label; });
+  model.position.get_proxy().signal_changed().connect([&n_position]() { ++n_position; });
+  model.pair.get_proxy().signal_changed().connect([&n_pair]() { ++n_pair; });
+  model.always.get_proxy().signal_changed().connect([&n_always]() { ++n_always; });
+
+  // Writes of unchanged values are not notified.
+  model.count = 0;
+  model.count = 1;
+  model.count = 1;
+  model.label = "a";
+  model.label = "a";
+  model.position = Point{ 1, 2 };
+  model.position = Point{ 1, 2 };
+  model.always = 0;
+  model.always = 0;
+  g_assert_cmpint(n_count, ==, 1);
+  g_assert_cmpint(n_label, ==, 1);
+  g_assert_cmpint(n_position, ==, 1);
+  g_assert_cmpint(n_always, ==, 2);
+
+  // Values of a custom type without operator== are never equal,
+  // also if they are stored inline and only a later member changes.
+  model.pair = InlineNoEquality{ 0, 1 };
+  model.pair = InlineNoEquality{ 0, 2 };
+  model.pair = InlineNoEquality{ 0, 2 };
+  g_assert_cmpint(n_pair, ==, 3);
+  g_assert_cmpint(model.pair.get_value().second, ==, 2);
+
+  // The same through the GObject property system.
+  model.set_property("count", 1);
+  model.set_property("count", 2);
+  model.set_property("position", Point{ 1, 2 });
+  g_assert_cmpint(n_count, ==, 2);
+  g_assert_cmpint(n_position, ==, 1);
+  g_assert_cmpint(model.count.get_value(), ==, 2);
+
+  // A batch notifies each changed property once.
+  {
+    Glib::NotifyBatch batch(model);
+    for (int i = 0; i < 10; ++i)
+    {
+      model.count = 10 + i;
+      model.always = i;
+    }
+    g_assert_cmpint(n_count, ==, 2);
+  }
+  g_assert_cmpint(n_count, ==, 3);
+  g_assert_cmpint(n_always, ==, 3);
+}
+
+} // namespace
+
+auto
+main() -> int
+{
+  test();
+  return 0;
+}
@@ -0,0 +1,194 @@
+#include <glib.h>
+#include <glibmm/init.h>
+#include <glibmm/object.h>
+#include <glibmm/property.h>
+#include <glibmm/propertyproxy.h>
+#include <cstring>
+
+// A C type with a property, and a subtype that overrides the property
+// with g_object_class_override_property().
+typedef struct
+{
+  GObject parent;
+  int value;
+} TestBase;
+
+typedef struct
+{
+  GObjectClass parent;
+} TestBaseClass;
+
+typedef struct
+{
+  TestBase parent;
+  int derived_value;
+} TestDerived;
+
+typedef struct
+{
+  TestBaseClass parent;
+} TestDerivedClass;
+
+enum { PROP_VALUE = 1 };
+
+static void
+test_base_set_property(GObject* object, guint property_id, const GValue* value, GParamSpec* pspec)
+{
+  if (property_id == PROP_VALUE)
+    reinterpret_cast<TestBase*>(object)->value = g_value_get_int(value);
+  else
+    G_OBJECT_WARN_INVALID_PROPERTY_ID(object, property_id, pspec);
+}
+
+static void
+test_base_get_property(GObject* object, guint property_id, GValue* value, GParamSpec* pspec)
+{
+  if (property_id == PROP_VALUE)
+    g_value_set_int(value, reinterpret_cast<TestBase*>(object)->value);
+  else
+    G_OBJECT_WARN_INVALID_PROPERTY_ID(object, property_id, pspec);
+}
+
+static void
+test_base_class_init(TestBaseClass* klass)
+{
+  GObjectClass* object_class = G_OBJECT_CLASS(klass);
+  object_class->set_property = test_base_set_property;
+  object_class->get_property = test_base_get_property;
+  g_object_class_install_property(object_class, PROP_VALUE,
+    g_param_spec_int("value", nullptr, nullptr, 0, 100, 0, G_PARAM_READWRITE));
+}
+
+static void
+test_base_init(TestBase*)
+{
+}
+
+G_DEFINE_TYPE(TestBase, test_base, G_TYPE_OBJECT)
+
+static void
+test_derived_set_property(
+  GObject* object, guint property_id, const GValue* value, GParamSpec* pspec)
+{
+  if (property_id == PROP_VALUE)
+    reinterpret_cast<TestDerived*>(object)->derived_value = g_value_get_int(value);
+  else
+    G_OBJECT_WARN_INVALID_PROPERTY_ID(object, property_id, pspec);
+}
+
+static void
+test_derived_get_property(GObject* object, guint property_id, GValue* value, GParamSpec* pspec)
+{
+  if (property_id == PROP_VALUE)
+    g_value_set_int(value, reinterpret_cast<TestDerived*>(object)->derived_value);
+  else
+    G_OBJECT_WARN_INVALID_PROPERTY_ID(object, property_id, pspec);
+}
+
+static void
+test_derived_class_init(TestDerivedClass* klass)
+{
+  GObjectClass* object_class = G_OBJECT_CLASS(klass);
+  object_class->set_property = test_derived_set_property;
+  object_class->get_property = test_derived_get_property;
+  g_object_class_override_property(object_class, PROP_VALUE, "value");
+}
+
+static void
+test_derived_init(TestDerived*)
+{
+}
+
+G_DEFINE_TYPE(TestDerived, test_derived, test_base_get_type())
+
+namespace {
+
+class Counter final: public Glib::Object {
+public:
+  Counter(): Glib::ObjectBase{"Counter"} {}
+  auto property_count() { return m_property_count.get_proxy(); }
+  auto property_label() { return m_property_label.get_proxy(); }
+
+private:
+  Glib::Property<int> m_property_count{*this, "count", 0};
+  Glib::Property<Glib::ustring> m_property_label{*this, "label"};
+};
+
+void
+test()
+{
+  Glib::init();
+
+  auto counter = Counter{};
+  int n_notified = 0;
+  counter.property_count().signal_changed().connect([&n_notified]() { ++n_notified; });
+
+  const Glib::PropertyId<int> count_id(G_OBJECT_TYPE(counter.gobj()), "count");
+  g_assert_true(bool(count_id));
+  g_assert_cmpstr(count_id.get_name(), ==, "count");
+
+  // Set and get through the GParamSpec.
+  counter.set_property(count_id, 5);
+  g_assert_cmpint(counter.get_property(count_id), ==, 5);
+  g_assert_cmpint(counter.property_count(), ==, 5);
+  g_assert_cmpint(n_notified, ==, 1);
+
+  // The property proxy, with its cached GParamSpec.
+  for (int i = 0; i < 10; ++i)
+    counter.property_count() = i;
+  g_assert_cmpint(counter.get_property(count_id), ==, 9);
+  g_assert_cmpint(n_notified, ==, 11);
+
+  // A value of another type is converted by g_object_set_property().
+  Glib::Value<long> long_value;
+  long_value.init(Glib::Value<long>::value_type());
+  long_value.set(17);
+  counter.set_property_value(count_id.gobj(), long_value);
+  g_assert_cmpint(counter.property_count(), ==, 17);
+
+  // Two properties whose names are stored at the same address
+  // don't share a cache entry.
+  char name[8] = "count";
+  g_assert_cmpint(counter.get_property<int>(name), ==, 17);
+  {
+    Glib::PropertyProxy<Glib::ustring> label(&counter, (std::strcpy(name, "label"), name));
+    label = "text";
+  }
+  {
+    Glib::PropertyProxy<int> count(&counter, (std::strcpy(name, "count"), name));
+    g_assert_cmpint(count.get_value(), ==, 17);
+  }
+  g_assert_cmpstr(counter.property_label().get_value().c_str(), ==, "text");
+
+  // A property of the base class is set and got directly.
+  auto base = Glib::wrap(G_OBJECT(g_object_new(test_base_get_type(), nullptr)));
+  const Glib::PropertyId<int> value_id(test_base_get_type(), "value");
+  base->set_property(value_id, 3);
+  g_assert_cmpint(reinterpret_cast<TestBase*>(base->gobj())->value, ==, 3);
+  g_assert_cmpint(base->get_property(value_id), ==, 3);
+
+  // The override of a subclass is not bypassed.
+  auto derived = Glib::wrap(G_OBJECT(g_object_new(test_derived_get_type(), nullptr)));
+  auto derived_c = reinterpret_cast<TestDerived*>(derived->gobj());
+  derived->set_property(value_id, 4);
+  g_assert_cmpint(derived_c->derived_value, ==, 4);
+  g_assert_cmpint(derived->get_property(value_id), ==, 4);
+  {
+    Glib::PropertyProxy<int> value(derived.get(), "value");
+    value = 5;
+    g_assert_cmpint(derived_c->derived_value, ==, 5);
+    g_assert_cmpint(value.get_value(), ==, 5);
+  }
+  derived->set_property("value", 6);
+  g_assert_cmpint(derived_c->derived_value, ==, 6);
+  g_assert_cmpint(derived_c->parent.value, ==, 0);
+}
+
+} // namespace
+
+auto
+main() -> int
+{
+  test();
+  return 0;
+}
@@ -0,0 +1,82 @@
+/* Copyright (C) 2026 The glibmm Development Team
+ *
+ * This file is part of glibmm.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <glibmm.h>
+#include <cstdlib> // EXIT_SUCCESS, EXIT_FAILURE
+#include <iostream>
+#include <string>
+#include <string_view>
+
+namespace
+{
+constexpr char static_key[] = "glibmm-test-static-key";
+
+const Glib::Quark&
+quark_from_literal()
+{
+  return GLIBMM_STATIC_QUARK("glibmm-test-literal-key");
+}
+} // anonymous namespace
+
+int
+main(int, char**)
+{
+  Glib::init();
+
+  bool ok = true;
+
+  // Not yet interned.
+  if (Glib::QueryQuark(std::string_view("glibmm-test-static-key")).id() != 0)
+  {
+    std::cerr << "QueryQuark found a string that was not interned." << std::endl;
+    ok = false;
+  }
+
+  const Glib::Quark& quark1 = Glib::static_quark<static_key>();
+  const Glib::Quark& quark2 = Glib::static_quark<static_key>();
+  if (&quark1 != &quark2 || quark1 != Glib::Quark(static_key) || quark1.id() == 0)
+  {
+    std::cerr << "static_quark() returned different quarks." << std::endl;
+    ok = false;
+  }
+
+  if (&quark_from_literal() != &quark_from_literal() ||
+      quark_from_literal() != Glib::QueryQuark("glibmm-test-literal-key"))
+  {
+    std::cerr << "GLIBMM_STATIC_QUARK() returned different quarks." << std::endl;
+    ok = false;
+  }
+
+  // A string_view needs not be nul-terminated.
+  const std::string_view view = std::string_view("glibmm-test-static-key-and-more").substr(0, 22);
+  if (Glib::QueryQuark(view) != quark1 || Glib::Quark(view) != quark1)
+  {
+    std::cerr << "Wrong quark from a string_view." << std::endl;
+    ok = false;
+  }
+
+  // Longer than the internal stack buffer.
+  const std::string long_key(300, 'x');
+  if (Glib::Quark(std::string_view(long_key)) != Glib::QueryQuark(long_key))
+  {
+    std::cerr << "Wrong quark from a long string_view." << std::endl;
+    ok = false;
+  }
+
+  return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,116 @@
+/* Copyright (C) 2026 The glibmm Development Team
+ *
+ * This file is part of glibmm.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <glibmm.h>
+#include <array>
+#include <cstdlib> // EXIT_SUCCESS, EXIT_FAILURE
+#include <iostream>
+#include <random>
+#include <vector>
+
+namespace
+{
+
+template <class Generator>
+bool
+check_doubles(Generator& generator, const char* name)
+{
+  std::vector<double> values(1000);
+  generator.fill(values);
+  for (const double value : values)
+    if (value < 0.0 || value >= 1.0)
+    {
+      std::cerr << name << ": fill() gave " << value << std::endl;
+      return false;
+    }
+
+  // Usable with the <random> distributions.
+  std::uniform_int_distribution<int> distribution(1, 6);
+  for (int i = 0; i < 1000; ++i)
+  {
+    const int value = distribution(generator);
+    if (value < 1 || value > 6)
+    {
+      std::cerr << name << ": uniform_int_distribution gave " << value << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+
+} // anonymous namespace
+
+int
+main(int, char**)
+{
+  Glib::init();
+
+  bool ok = true;
+
+  // Reference values of the xoshiro256** and PCG32 reference implementations.
+  {
+    Glib::Xoshiro256 generator(12345);
+    if (generator() != G_GUINT64_CONSTANT(0xbe6a36374160d49b) ||
+        generator() != G_GUINT64_CONSTANT(0x214aaa0637a688c6))
+    {
+      std::cerr << "Xoshiro256: Unexpected sequence." << std::endl;
+      ok = false;
+    }
+  }
+  {
+    Glib::Pcg32 generator(42, 54);
+    std::array<guint32, 3> values;
+    generator.fill(values);
+    if (values[0] != 0xa15c02b7 || values[1] != 0x7b47f409 || values[2] != 0xba1d3330)
+    {
+      std::cerr << "Pcg32: Unexpected sequence." << std::endl;
+      ok = false;
+    }
+  }
+
+  // fill() continues the sequence of operator()().
+  {
+    Glib::Xoshiro256 generator1(7);
+    Glib::Xoshiro256 generator2(7);
+    std::vector<guint64> values(10);
+    generator1.fill(values);
+    for (const guint64 value : values)
+      ok = ok && value == generator2();
+    ok = ok && generator1() == generator2();
+    if (!ok)
+      std::cerr << "Xoshiro256: fill() differs from operator()()." << std::endl;
+  }
+
+  {
+    Glib::Xoshiro256 generator1(7);
+    Glib::Xoshiro256 generator2(7);
+    generator2.jump();
+    if (generator1() == generator2())
+    {
+      std::cerr << "Xoshiro256: jump() did not change the sequence." << std::endl;
+      ok = false;
+    }
+  }
+
+  Glib::Rand rand(1);
+  ok = check_doubles(rand, "Rand") && ok;
+  ok = check_doubles(Glib::Xoshiro256::get_thread_default(), "Xoshiro256") && ok;
+  ok = check_doubles(Glib::Pcg32::get_thread_default(), "Pcg32") && ok;
+
+  return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
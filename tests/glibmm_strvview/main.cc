@@ -0,0 +1,87 @@
+/* Copyright (C) 2026 The glibmm Development Team
+ *
+ * This file is part of glibmm.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <glibmm.h>
+#include <cstdlib> // EXIT_SUCCESS
+#include <string>
+#include <string_view>
+#include <vector>
+
+int
+main(int, char**)
+{
+  Glib::init();
+
+  {
+    Glib::StrvView view(g_strsplit("a,bc,,d", ",", -1));
+    g_assert_cmpuint(view.size(), ==, 4);
+    g_assert_false(view.empty());
+    g_assert_true(view.front() == "a");
+    g_assert_true(view[1] == "bc");
+    g_assert_true(view[2].empty());
+    g_assert_cmpstr(view.c_str(3), ==, "d");
+
+    std::string joined;
+    for (std::string_view str : view)
+      joined += str;
+    g_assert_cmpstr(joined.c_str(), ==, "abcd");
+    g_assert_cmpint(view.end() - view.begin(), ==, 4);
+
+    const std::vector<Glib::ustring> vector = view;
+    g_assert_true(vector == std::vector<Glib::ustring>({ "a", "bc", "", "d" }));
+
+    Glib::StrvView moved(std::move(view));
+    g_assert_true(view.empty());
+    g_assert_null(view.data());
+    char** const strv = moved.release();
+    g_assert_true(moved.empty());
+    g_assert_nonnull(strv);
+    g_assert_cmpuint(g_strv_length(strv), ==, 4);
+    g_strfreev(strv);
+  }
+
+  {
+    Glib::StrvView view(nullptr);
+    g_assert_true(view.empty());
+    g_assert_true(view.begin() == view.end());
+  }
+
+  {
+    Glib::KeyFile key_file;
+    key_file.load_from_data("[first]\nlist=x;y;z;\n[second]\nkey=value\n");
+    const auto groups = key_file.get_groups_view();
+    g_assert_cmpuint(groups.size(), ==, 2);
+    g_assert_true(groups[0] == "first");
+    g_assert_true(groups[1] == "second");
+    const auto keys = key_file.get_keys_view("second");
+    g_assert_cmpuint(keys.size(), ==, 1);
+    g_assert_true(keys.front() == "key");
+    const auto list = key_file.get_string_list_view("first", "list");
+    g_assert_true(list.to_string_vector() == std::vector<std::string>({ "x", "y", "z" }));
+  }
+
+  {
+    auto regex = Glib::Regex::create("\\s*;\\s*");
+    const auto parts = regex->split_view("one ; two;three");
+    g_assert_cmpuint(parts.size(), ==, 3);
+    g_assert_true(parts[0] == "one");
+    g_assert_true(parts[2] == "three");
+  }
+
+  return EXIT_SUCCESS;
+}
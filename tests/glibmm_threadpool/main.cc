@@ -0,0 +1,117 @@
+/* Copyright (C) 2026 The glibmm Development Team
+ *
+ * This file is part of glibmm.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <atomic>
+#include <cstdlib> // EXIT_SUCCESS, EXIT_FAILURE
+#include <glibmm.h>
+#include <iostream>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+int
+main(int, char**)
+{
+  Glib::init();
+
+  bool ok = true;
+  std::atomic<int> n_nested{ 0 };
+  {
+    Glib::ThreadPool pool(4);
+    if (pool.get_n_threads() != 4)
+    {
+      std::cerr << "get_n_threads() returned " << pool.get_n_threads() << std::endl;
+      ok = false;
+    }
+
+    // Tasks that submit more tasks.
+    std::vector<std::future<int>> futures;
+    for (int i = 0; i < 1000; ++i)
+      futures.push_back(pool.submit([i, &pool, &n_nested]()
+        {
+          pool.submit([&n_nested]() { ++n_nested; });
+          return i;
+        }));
+    long sum = 0;
+    for (auto& future : futures)
+      sum += future.get();
+    if (sum != 999 * 1000 / 2)
+    {
+      std::cerr << "Wrong sum of results: " << sum << std::endl;
+      ok = false;
+    }
+
+    // Exceptions are stored in the future.
+    auto throwing = pool.submit([]() -> int { throw std::runtime_error("expected"); });
+    try
+    {
+      throwing.get();
+      std::cerr << "No exception from a throwing task." << std::endl;
+      ok = false;
+    }
+    catch (const std::runtime_error&)
+    {
+    }
+
+    // A cancelled task is not executed.
+    bool executed = false;
+    auto cancelled = pool.submit([&executed]() { executed = true; }, []() { return true; });
+    try
+    {
+      cancelled.get();
+      ok = false;
+    }
+    catch (const std::future_error& ex)
+    {
+      if (ex.code() != std::future_errc::broken_promise)
+        ok = false;
+    }
+    if (executed)
+    {
+      std::cerr << "A cancelled task was executed." << std::endl;
+      ok = false;
+    }
+
+    // The result is delivered in the main context.
+    auto mainloop = Glib::MainLoop::create();
+    const auto main_thread_id = std::this_thread::get_id();
+    bool delivered_in_main_thread = false;
+    pool.submit([]() { return 42; },
+      [&](std::future<int>& result)
+      {
+        delivered_in_main_thread =
+          std::this_thread::get_id() == main_thread_id && result.get() == 42;
+        mainloop->quit();
+      },
+      Glib::MainContext::get_default());
+    mainloop->run();
+    if (!delivered_in_main_thread)
+    {
+      std::cerr << "The result was not delivered in the main thread." << std::endl;
+      ok = false;
+    }
+  }
+  // The destructor has waited for all nested tasks.
+  if (n_nested != 1000)
+  {
+    std::cerr << "Nested tasks executed: " << n_nested << std::endl;
+    ok = false;
+  }
+
+  return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,192 @@
+/* Copyright (C) 2026 The glibmm Development Team
+ *
+ * This file is part of glibmm.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <cstdlib> // EXIT_SUCCESS, EXIT_FAILURE
+#include <glibmm.h>
+#include <iostream>
+#include <string>
+
+namespace
+{
+
+const char* const iso8601_strings[] = {
+  "2026-03-29T01:59:59Z",
+  "2026-03-29T03:00:00.5+02:00",
+  "1999-12-31 23:59:59.999999-0930",
+  "0001-01-01T00:00:00Z",
+  "9999-12-31t23:59:59.000001+14",
+  "2024-02-29T12:00:00",
+  // Passed to g_date_time_new_from_iso8601().
+  "2026-W12-3T10:00:00Z",
+  "2026-088T10:00:00+01:00",
+  "20260329T100000Z",
+  "2026-03-29T10:00:00.1234567Z",
+};
+
+const char* const invalid_strings[] = {
+  "",
+  "2026-02-29T00:00:00Z",
+  "2026-03-29T24:00:00Z",
+  "2026-03-29T10:00:00+",
+  "2026-13-01T10:00:00Z",
+  "not a date",
+};
+
+bool
+check_equal(const Glib::Timestamp& timestamp, const Glib::DateTime& date_time, const char* what)
+{
+  if (timestamp.to_unix_usec() == date_time.to_unix_usec() &&
+      timestamp.get_utc_offset() == date_time.get_utc_offset())
+    return true;
+
+  std::cerr << what << ": " << timestamp.format_iso8601() << " != "
+            << date_time.format_iso8601() << std::endl;
+  return false;
+}
+
+} // anonymous namespace
+
+int
+main(int, char**)
+{
+  Glib::init();
+
+  bool ok = true;
+  const auto default_tz = Glib::TimeZone::create_identifier("+05:30");
+
+  for (const char* text : iso8601_strings)
+  {
+    const auto timestamp = Glib::Timestamp::parse_iso8601(text, 5 * 3600 + 30 * 60);
+    const auto date_time = Glib::DateTime::create_from_iso8601(text, default_tz);
+    if (!timestamp || !date_time)
+    {
+      std::cerr << "Can't parse " << text << std::endl;
+      ok = false;
+      continue;
+    }
+    ok &= check_equal(*timestamp, date_time, text);
+
+    // Formatting
+    char buffer[Glib::Timestamp::iso8601_buffer_size];
+    const std::size_t length = timestamp->format_iso8601(buffer, sizeof(buffer));
+    if (std::string(buffer, length) != date_time.format_iso8601().raw())
+    {
+      std::cerr << text << ": format_iso8601() gave " << buffer << std::endl;
+      ok = false;
+    }
+    if (length > 0 && timestamp->format_iso8601(buffer, length) != 0)
+    {
+      std::cerr << text << ": format_iso8601() did not detect a short buffer." << std::endl;
+      ok = false;
+    }
+
+    // Conversion to and from DateTime
+    ok &= check_equal(*timestamp, timestamp->to_date_time(), "to_date_time()");
+    ok &= check_equal(Glib::Timestamp::from_date_time(date_time), date_time, "from_date_time()");
+
+    if (timestamp->get_year() != date_time.get_year() ||
+        timestamp->get_month() != date_time.get_month() ||
+        timestamp->get_day_of_month() != date_time.get_day_of_month() ||
+        timestamp->get_day_of_week() != date_time.get_day_of_week() ||
+        timestamp->get_day_of_year() != date_time.get_day_of_year() ||
+        timestamp->get_hour() != date_time.get_hour() ||
+        timestamp->get_minute() != date_time.get_minute() ||
+        timestamp->get_second() != date_time.get_second() ||
+        timestamp->get_microsecond() != date_time.get_microsecond())
+    {
+      std::cerr << text << ": Wrong date or time fields." << std::endl;
+      ok = false;
+    }
+  }
+
+  for (const char* text : invalid_strings)
+  {
+    if (Glib::Timestamp::parse_iso8601(text))
+    {
+      std::cerr << "Invalid string parsed: " << text << std::endl;
+      ok = false;
+    }
+  }
+
+  // Precompiled and DateTime-based formats give the same result as DateTime::format().
+  const char* const formats[] = {
+    "%F %T.%f %z",
+    "%C%y-%m-%d %H:%M:%S %:z %::z %:::z",
+    "[%D %R] %e %k %l %I %j %u %w %s %Y %%%n%t",
+    "%a %d %b %Y %H:%M:%S %Z",
+    "%Oy %-d %_m",
+  };
+  const auto utc = Glib::TimeZone::create_utc();
+  const auto timestamps = {
+    Glib::Timestamp::create_utc(2026, 3, 29, 1, 2, 3, 4),
+    Glib::Timestamp::create_utc(2026, 12, 31, 23, 59, 59).to_utc_offset(-(9 * 3600 + 30 * 60)),
+    Glib::Timestamp::create_utc(1969, 7, 20, 20, 17, 40).to_utc_offset(3600 + 17 * 60 + 5),
+    Glib::Timestamp::create_utc(1, 1, 1, 0, 0, 0),
+  };
+  for (const char* format : formats)
+  {
+    const Glib::TimestampFormat timestamp_format(format);
+    for (const auto& timestamp : timestamps)
+    {
+      const auto expected = timestamp.to_date_time().format(format);
+      char buffer[256];
+      const std::size_t length = timestamp_format.format(timestamp, buffer, sizeof(buffer));
+      if (std::string(buffer, length) != expected.raw() ||
+          timestamp_format.format(timestamp) != expected)
+      {
+        std::cerr << "Format \"" << format << "\": " << buffer << " != " << expected << std::endl;
+        ok = false;
+      }
+    }
+  }
+  if (!Glib::TimestampFormat("%F %T.%f %z").is_precompiled() ||
+      Glib::TimestampFormat("%a").is_precompiled())
+  {
+    std::cerr << "Wrong is_precompiled()." << std::endl;
+    ok = false;
+  }
+
+  // Time zones
+  const auto now = Glib::Timestamp::now_local();
+  const auto now_date_time = Glib::DateTime::create_now_local(now.to_unix_usec() / G_USEC_PER_SEC);
+  if (now.get_utc_offset() != now_date_time.get_utc_offset())
+  {
+    std::cerr << "now_local() has the wrong UTC offset." << std::endl;
+    ok = false;
+  }
+  const auto tz = Glib::TimeZone::create_identifier("-03:00");
+  if (now.to_timezone(tz).get_utc_offset_seconds() != -3 * 3600 || now.to_timezone(tz) != now ||
+      now.to_timezone(utc).to_utc() != now)
+  {
+    std::cerr << "to_timezone() failed." << std::endl;
+    ok = false;
+  }
+
+  // Arithmetic
+  const auto start = Glib::Timestamp::create_utc(2026, 1, 31, 12, 0, 0);
+  const auto end = start.add(G_TIME_SPAN_DAY).add_seconds(1.5);
+  if (end.difference(start) != G_TIME_SPAN_DAY + 1500000 || !(start < end) ||
+      end.get_month() != 2 || end.get_day_of_month() != 1 || end.get_microsecond() != 500000)
+  {
+    std::cerr << "Arithmetic failed." << std::endl;
+    ok = false;
+  }
+
+  return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,132 @@
+/* Copyright (C) 2026 The glibmm Development Team
+ *
+ * This file is part of glibmm.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <algorithm>
+#include <cstdlib> // EXIT_SUCCESS, EXIT_FAILURE
+#include <glibmm.h>
+#include <iostream>
+#include <vector>
+
+namespace
+{
+
+bool
+check_time_zone(const Glib::TimeZone& tz, const std::vector<gint64>& times)
+{
+  bool ok = true;
+
+  const auto local_times = tz.to_local(times);
+  for (std::size_t i = 0; i < times.size(); ++i)
+  {
+    const int interval = tz.find_interval(Glib::TimeType::UNIVERSAL, times[i]);
+    if (local_times[i] != times[i] + tz.get_offset(interval))
+    {
+      std::cerr << tz.get_identifier() << ": to_local(" << times[i] << ") gave "
+                << local_times[i] << std::endl;
+      ok = false;
+      break;
+    }
+  }
+
+  for (auto type : { Glib::TimeType::STANDARD, Glib::TimeType::DAYLIGHT })
+  {
+    const auto utc_times = tz.to_utc(local_times, type);
+    for (std::size_t i = 0; i < local_times.size(); ++i)
+    {
+      gint64 time = local_times[i];
+      const int interval = tz.adjust_time(type, time);
+      if (utc_times[i] != time - tz.get_offset(interval))
+      {
+        std::cerr << tz.get_identifier() << ": to_utc(" << local_times[i] << ") gave "
+                  << utc_times[i] << std::endl;
+        ok = false;
+        break;
+      }
+    }
+  }
+  return ok;
+}
+
+} // anonymous namespace
+
+int
+main(int, char**)
+{
+  Glib::init();
+
+  bool ok = true;
+
+  // Cache
+  const auto berlin1 = Glib::TimeZone::create_cached("Europe/Berlin");
+  const auto berlin2 = Glib::TimeZone::create_cached("Europe/Berlin");
+  if (berlin1.gobj() != berlin2.gobj())
+  {
+    std::cerr << "create_cached() loaded a time zone twice." << std::endl;
+    ok = false;
+  }
+  if (Glib::TimeZone::create_cached("No/Such_Zone"))
+  {
+    std::cerr << "create_cached() returned a valid time zone for an invalid identifier." << std::endl;
+    ok = false;
+  }
+  // Time zones from the cache remain valid when the cache is cleared.
+  Glib::TimeZone::clear_cache();
+  if (!berlin1 && Glib::TimeZone::create_identifier("Europe/Berlin"))
+  {
+    std::cerr << "create_cached() returned an invalid time zone." << std::endl;
+    ok = false;
+  }
+
+  // Sorted times around many daylight saving time transitions, every 20 minutes
+  // from 2020 to 2030, plus some times just before and after transitions.
+  std::vector<gint64> times;
+  for (gint64 t = 1577836800; t < 1893456000; t += 20 * 60)
+    times.push_back(t);
+  for (gint64 t = 1616893200 - 3; t < 1616893200 + 3; ++t)
+    times.push_back(t);
+  std::sort(times.begin(), times.end());
+
+  // The same times, shuffled.
+  std::vector<gint64> shuffled_times = times;
+  for (std::size_t i = 0; i < shuffled_times.size(); ++i)
+    std::swap(shuffled_times[i], shuffled_times[(i * 7919) % shuffled_times.size()]);
+
+  for (const char* identifier :
+    { "Europe/Berlin", "America/New_York", "Australia/Lord_Howe", "+05:30", "UTC" })
+  {
+    const auto tz = Glib::TimeZone::create_cached(identifier);
+    if (!tz)
+      continue; // Not in this system's time zone database.
+    ok &= check_time_zone(tz, times);
+    ok &= check_time_zone(tz, shuffled_times);
+  }
+  ok &= check_time_zone(Glib::TimeZone::create_local(), times);
+
+  // In-place conversion.
+  const auto tz = Glib::TimeZone::create_identifier("-02:00");
+  std::vector<gint64> in_place = times;
+  tz.to_local(in_place.data(), in_place.data(), in_place.size());
+  if (in_place.empty() || in_place.back() != times.back() - 2 * 3600)
+  {
+    std::cerr << "In-place to_local() failed." << std::endl;
+    ok = false;
+  }
+
+  return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -1,6 +1,7 @@
 #include "../glibmm_object/test_derived_object.h"
 #include <glibmm.h>
 #include <cassert>
+#include <vector>
 
 namespace Gdk { class Pixbuf; } // Incomplete type
 namespace Gtk { class Widget {}; } // Complete type
@@ -10,6 +11,17 @@ struct Foo
   int bar = 1;
 };
 
+struct Point
+{
+  int x = 0;
+  double y = 0.0;
+};
+
+namespace Glib::Traits
+{
+template <> struct ValueInlineStorage<Point> : std::true_type {};
+}
+
 void
 test()
 {
@@ -33,6 +45,29 @@ test()
     assert(v2.bar == 1);
   }
 
+  {
+    // custom, stored inline
+    Glib::Value<Point> value;
+    value.init(Glib::Value<Point>::value_type()); // TODO: Avoid this step?
+    assert(value.get().x == 0 && value.get().y == 0.0);
+    value.set(Point{ 3, 0.5 });
+
+    Glib::Value<Point> value2;
+    value2.init(Glib::Value<Point>::value_type()); // TODO: Avoid this step?
+    value2 = value;
+    const auto v2 = value2.get();
+    assert(v2.x == 3 && v2.y == 0.5);
+  }
+
+  {
+    // custom, moved
+    Glib::Value<std::vector<int>> value;
+    value.init(Glib::Value<std::vector<int>>::value_type()); // TODO: Avoid this step?
+    std::vector<int> data(10, 7);
+    value.set(std::move(data));
+    assert(value.get().size() == 10);
+  }
+
   {
     Foo foo;
 
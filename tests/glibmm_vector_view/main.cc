@@ -0,0 +1,95 @@
+/* Copyright (C) 2026 The glibmm Development Team
+ *
+ * This file is part of glibmm.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <glibmm.h>
+#include <cstdlib> // EXIT_SUCCESS
+#include <string>
+#include <vector>
+
+int
+main(int, char**)
+{
+  Glib::init();
+
+  // A 0-terminated array, deep ownership.
+  {
+    const char* const strings[] = { "a", "b", "c", nullptr };
+    auto view = Glib::ArrayHandler<Glib::ustring>::array_to_view(
+      g_strdupv(const_cast<char**>(strings)), Glib::OWNERSHIP_DEEP);
+    g_assert_false(view.empty());
+    g_assert_true(view.front() == "a");
+    Glib::ustring joined;
+    for (const auto& str : view)
+      joined += str;
+    g_assert_cmpstr(joined.c_str(), ==, "abc");
+    g_assert_cmpuint(view.size(), ==, 3);
+    g_assert_true(view[2] == "c");
+
+    auto moved = std::move(view);
+    g_assert_true(view.empty());
+    g_assert_cmpuint(view.size(), ==, 0);
+    const std::vector<Glib::ustring> vector = moved;
+    g_assert_true(vector == std::vector<Glib::ustring>({ "a", "b", "c" }));
+  }
+
+  // An array with a known size, no ownership.
+  {
+    const char* const strings[] = { "x", "y" };
+    Glib::ArrayView<std::string> view(strings, 2, Glib::OWNERSHIP_NONE);
+    g_assert_cmpuint(view.size(), ==, 2);
+    g_assert_cmpint(view.end() - view.begin(), ==, 2);
+    g_assert_true(view.data() == strings);
+  }
+
+  // Empty arrays.
+  {
+    auto view = Glib::ArrayHandler<Glib::ustring>::array_to_view(nullptr, Glib::OWNERSHIP_DEEP);
+    g_assert_true(view.empty());
+    g_assert_true(view.begin() == view.end());
+    auto empty = Glib::ArrayHandler<Glib::ustring>::array_to_view(
+      g_new0(char*, 1), Glib::OWNERSHIP_DEEP);
+    g_assert_true(empty.empty());
+    g_assert_cmpuint(empty.size(), ==, 0);
+  }
+
+  // A GList, deep ownership.
+  {
+    GList* glist = nullptr;
+    glist = g_list_prepend(glist, g_strdup("2"));
+    glist = g_list_prepend(glist, g_strdup("1"));
+    auto view = Glib::ListHandler<Glib::ustring>::list_to_view(glist, Glib::OWNERSHIP_DEEP);
+    g_assert_cmpuint(view.size(), ==, 2);
+    g_assert_true(view.front() == "1");
+    Glib::ListView<Glib::ustring> assigned;
+    assigned = std::move(view);
+    g_assert_true(view.empty());
+    g_assert_true(assigned.to_vector() == std::vector<Glib::ustring>({ "1", "2" }));
+  }
+
+  // A GSList, deep ownership.
+  {
+    GSList* gslist = g_slist_prepend(nullptr, g_strdup("only"));
+    auto view = Glib::SListHandler<Glib::ustring>::slist_to_view(gslist, Glib::OWNERSHIP_DEEP);
+    auto iter = view.begin();
+    const auto previous = iter++;
+    g_assert_true(*previous == "only");
+    g_assert_true(iter == view.end());
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -42,12 +42,18 @@ def gmmproc():
 
   # gmmproc generates output_dir/basefilename.cc, output_dir/basefilename.h
   # and output_dir/private/{basefilename}_p.h
+  # The parsed .defs and docs files are cached in the build directory,
+  # so each gmmproc process does not have to parse them again.
+  cache_dir = os.getenv('GMMPROC_CACHE_DIR', os.path.join(gmmproc_dir, 'gmmproc-cache'))
+
   cmd = [
     'perl',
     '-I' + pm_dir,
     '--',
     os.path.join(gmmproc_dir, 'gmmproc'),
   ] + include_m4_dirs + [
+    '--cache',
+    cache_dir,
     '--defs',
     src_dir,
     basefilename,
@@ -0,0 +1,524 @@
+/* Copyright (C) 2026 The glibmm Development Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "mmgir.h"
+
+#include "ir_cache.h"
+
+#include <fmt/format.h>
+
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <system_error>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+
+using namespace gir;
+
+namespace fs = std::filesystem;
+
+namespace {
+
+constexpr std::string_view IR_MAGIC = "mmgir-ir";
+
+// Increment when the structs in schema.h or the serialization below change.
+constexpr std::uint32_t IR_FORMAT_VERSION = 1;
+
+constexpr std::uint32_t NULL_INDEX = 0xffffffff;
+
+// The fields of each struct in schema.h, in serialization order. The same
+// functions are used for writing and reading. Type and ArrayType objects are
+// owned by their Namespace and handled by the archives.
+
+template <class Archive> void fields(Archive& ar, Include& v)
+{ ar(v.name, v.version); }
+
+template <class Archive> void fields(Archive& ar, Repository& v)
+{ ar(v.version, v.identifier_prefixes, v.symbol_prefixes, v.includes, v.namespaces); }
+
+template <class Archive> void fields(Archive& ar, Annotation& v)
+{ ar(v.name, v.value); }
+
+template <class Archive> void fields(Archive& ar, InfoAttributes& v)
+{ ar(v.is_introspectable, v.is_deprecated, v.deprecated_version, v.version, v.stability); }
+
+template <class Archive> void fields(Archive& ar, SourcePosition& v)
+{ ar(v.filename, v.line, v.column); }
+
+template <class Archive> void fields(Archive& ar, Documentation& v)
+{ ar(v.src_pos, v.text); }
+
+template <class Archive> void fields(Archive& ar, DocElements& v)
+{ ar(v.doc, v.src_pos); }
+
+template <class Archive> void fields(Archive& ar, InfoElements& v)
+{ ar(v.doc_elements, v.annotations); }
+
+template <class Archive> void fields(Archive& ar, Type& v)
+{ ar(v.name, v.c_type, v.doc_elements); }
+
+template <class Archive> void fields(Archive& ar, ArrayType& v)
+{ ar(v.name, v.c_type, v.is_zero_terminated, v.length, v.fixed_size, v.element_type); }
+
+template <class Archive> void fields(Archive& ar, Alias& v)
+{ ar(v.info_attributes, v.name, v.c_type, v.info_elements, v.type); }
+
+template <class Archive> void fields(Archive& ar, Member& v)
+{ ar(v.info_attributes, v.name, v.value, v.c_identifier, v.nickname, v.info_elements); }
+
+template <class Archive> void fields(Archive& ar, CallableAttributes& v)
+{
+    ar(v.info_attributes, v.name, v.c_identifier, v.shadowed_by, v.shadows, v.moved_to,
+       v.async_func, v.sync_func, v.finish_func, v.can_throw);
+}
+
+template <class Archive> void fields(Archive& ar, Param& v)
+{
+    ar(v.name, v.is_nullable, v.closure, v.destroy, v.scope, v.direction,
+       v.is_caller_allocated, v.is_optional, v.is_skippable, v.ownership,
+       v.info_elements, v.type);
+}
+
+template <class Archive> void fields(Archive& ar, InstanceParam& v)
+{
+    ar(v.name, v.is_nullable, v.direction, v.is_caller_allocated, v.ownership,
+       v.doc_elements, v.type);
+}
+
+template <class Archive> void fields(Archive& ar, CallableParams& v)
+{ ar(v.params, v.instance_param); }
+
+template <class Archive> void fields(Archive& ar, CallableReturn& v)
+{
+    ar(v.is_nullable, v.closure, v.destroy, v.scope, v.is_skippable, v.ownership,
+       v.info_elements, v.type);
+}
+
+template <class Archive> void fields(Archive& ar, FunctionInline& v)
+{ ar(v.attributes, v.params, v.return_type, v.doc_elements); }
+
+template <class Archive> void fields(Archive& ar, Function& v)
+{ ar(v.detail, v.annotations); }
+
+template <class Archive> void fields(Archive& ar, MethodInline& v)
+{ ar(v.func); }
+
+template <class Archive> void fields(Archive& ar, Method& v)
+{ ar(v.func, v.set_property, v.get_property); }
+
+template <class Archive> void fields(Archive& ar, Constructor& v)
+{ ar(v.func); }
+
+template <class Archive> void fields(Archive& ar, VirtualMethod& v)
+{ ar(v.func, v.invoker); }
+
+template <class Archive> void fields(Archive& ar, Bitfield& v)
+{
+    ar(v.info_attributes, v.name, v.c_type, v.glib_type_name, v.glib_type_func,
+       v.info_elements, v.members, v.functions, v.inline_functions);
+}
+
+template <class Archive> void fields(Archive& ar, Enum& v)
+{
+    ar(v.info_attributes, v.name, v.c_type, v.glib_type_name, v.glib_type_func,
+       v.error_domain, v.info_elements, v.members, v.functions, v.inline_functions);
+}
+
+template <class Archive> void fields(Archive& ar, Property& v)
+{
+    ar(v.info_attributes, v.name, v.is_writable, v.is_readable, v.is_set_on_construction,
+       v.is_set_only_during_construction, v.setter_func, v.getter_func, v.default_value,
+       v.ownership, v.info_elements, v.type);
+}
+
+template <class Archive> void fields(Archive& ar, Signal& v)
+{
+    ar(v.info_attributes, v.name, v.is_detailed, v.when, v.is_action, v.no_hooks,
+       v.no_recurse, v.emitter, v.info_elements, v.params, v.return_type);
+}
+
+template <class Archive> void fields(Archive& ar, Union& v)
+{
+    ar(v.info_attributes, v.name, v.c_type, v.symbol_prefix, v.glib_type_name,
+       v.glib_type_func, v.copy_function, v.free_function, v.info_elements,
+       v.constructors, v.methods, v.inline_methods, v.functions, v.inline_functions);
+}
+
+template <class Archive> void fields(Archive& ar, Record& v)
+{
+    ar(v.info_attributes, v.name, v.c_type, v.glib_type_name, v.glib_type_func,
+       v.symbol_prefix, v.for_gtype_struct, v.copy_function, v.free_function,
+       v.is_opaque, v.is_disguised_pointer, v.is_foreign, v.info_elements,
+       v.functions, v.inline_functions, v.methods, v.inline_methods, v.constructors);
+}
+
+template <class Archive> void fields(Archive& ar, Prerequisite& v)
+{ ar(v.name); }
+
+template <class Archive> void fields(Archive& ar, Implements& v)
+{ ar(v.name); }
+
+template <class Archive> void fields(Archive& ar, Interface& v)
+{
+    ar(v.info_attributes, v.name, v.glib_type_name, v.glib_type_func, v.c_type,
+       v.symbol_prefix, v.glib_type_struct, v.info_elements, v.prerequisites,
+       v.implements, v.functions, v.inline_functions, v.methods, v.inline_methods,
+       v.virtual_methods, v.properties, v.signals, v.constructor);
+}
+
+template <class Archive> void fields(Archive& ar, Class& v)
+{
+    ar(v.info_attributes, v.name, v.glib_type_name, v.glib_type_func, v.parent,
+       v.glib_type_struct, v.glib_ref_func, v.glib_unref_func, v.glib_set_value_func,
+       v.glib_get_value_func, v.c_type, v.symbol_prefix, v.is_abstract,
+       v.is_glib_fundamental, v.is_final, v.info_elements, v.implements,
+       v.constructors, v.methods, v.inline_methods, v.functions, v.inline_functions,
+       v.virtual_methods, v.properties, v.signals, v.unions, v.records);
+}
+
+template <class Archive> void fields(Archive& ar, DocSection& v)
+{ ar(v.name, v.doc_elements); }
+
+template <class Archive> void fields(Archive& ar, Namespace& v)
+{
+    // The types must be known before any pointer to them.
+    ar.type_pools(v.types, v.array_types);
+    ar(v.name, v.version, v.identifier_prefixes, v.symbol_prefixes, v.aliases,
+       v.classes, v.interfaces, v.records, v.enums, v.functions, v.inline_functions,
+       v.unions, v.bitfields, v.annotations, v.doc_sections);
+}
+
+template <class T>
+constexpr bool is_schema_struct_v = std::is_class_v<T> && !std::is_same_v<T, std::string>;
+
+class Writer
+{
+public:
+    template <class... Ts>
+    void operator()(Ts&... values) { (io(values), ...); }
+
+    void io(bool& v) { put(v ? 1 : 0, 1); }
+    void io(int& v) { put(static_cast<std::uint32_t>(v), 4); }
+    void io(std::uint32_t& v) { put(v, 4); }
+    void io(std::string& v)
+    {
+        put(v.size(), 4);
+        m_data.append(v);
+    }
+
+    template <class E, std::enable_if_t<std::is_enum_v<E>, int> = 0>
+    void io(E& v) { put(static_cast<std::uint64_t>(v), 1); }
+
+    template <class T>
+    void io(std::optional<T>& v)
+    {
+        put(v.has_value(), 1);
+        if (v) io(*v);
+    }
+
+    template <class T>
+    void io(std::vector<T>& v)
+    {
+        put(v.size(), 4);
+        for (T& element : v) io(element);
+    }
+
+    void io(Type*& v) { put(index_of(m_type_indices, v), 4); }
+    void io(ArrayType*& v) { put(index_of(m_array_type_indices, v), 4); }
+
+    template <class... Ts>
+    void io(std::variant<Ts...>& v)
+    {
+        put(v.index(), 1);
+        std::visit([this](auto& alternative) { io(alternative); }, v);
+    }
+
+    void io(VarArgs&) {}
+
+    template <class T, std::enable_if_t<is_schema_struct_v<T>, int> = 0>
+    void io(T& v) { fields(*this, v); }
+
+    void type_pools(std::vector<std::unique_ptr<Type>>& types,
+                    std::vector<std::unique_ptr<ArrayType>>& array_types)
+    {
+        m_type_indices.clear();
+        m_array_type_indices.clear();
+        for (std::size_t i = 0; i < types.size(); ++i)
+            m_type_indices.emplace(types[i].get(), i);
+        for (std::size_t i = 0; i < array_types.size(); ++i)
+            m_array_type_indices.emplace(array_types[i].get(), i);
+
+        put(types.size(), 4);
+        put(array_types.size(), 4);
+        for (auto& type : types) io(*type);
+        for (auto& type : array_types) io(*type);
+    }
+
+    std::string take_data() { return std::move(m_data); }
+
+private:
+    // Little-endian, independent of the host.
+    void put(std::uint64_t value, int n_bytes)
+    {
+        for (int i = 0; i < n_bytes; ++i)
+            m_data.push_back(static_cast<char>((value >> (8 * i)) & 0xff));
+    }
+
+    template <class T>
+    static std::uint32_t index_of(const std::unordered_map<const T*, std::uint32_t>& indices,
+                                  const T* ptr)
+    {
+        auto it = indices.find(ptr);
+        return it == indices.end() ? NULL_INDEX : it->second;
+    }
+
+    std::string m_data;
+    std::unordered_map<const Type*, std::uint32_t> m_type_indices;
+    std::unordered_map<const ArrayType*, std::uint32_t> m_array_type_indices;
+};
+
+class Reader
+{
+public:
+    explicit Reader(std::string_view data) : m_data(data) {}
+
+    template <class... Ts>
+    void operator()(Ts&... values) { (io(values), ...); }
+
+    void io(bool& v) { v = get(1) != 0; }
+    void io(int& v) { v = static_cast<int>(static_cast<std::uint32_t>(get(4))); }
+    void io(std::uint32_t& v) { v = static_cast<std::uint32_t>(get(4)); }
+    void io(std::string& v)
+    {
+        const std::size_t size = get(4);
+        if (!check(size <= m_data.size() - m_pos)) return;
+        v.assign(m_data.data() + m_pos, size);
+        m_pos += size;
+    }
+
+    template <class E, std::enable_if_t<std::is_enum_v<E>, int> = 0>
+    void io(E& v) { v = static_cast<E>(get(1)); }
+
+    template <class T>
+    void io(std::optional<T>& v)
+    {
+        if (get(1)) {
+            io(v.emplace());
+        } else {
+            v.reset();
+        }
+    }
+
+    template <class T>
+    void io(std::vector<T>& v)
+    {
+        const std::size_t size = get(4);
+        // Each element takes at least one byte.
+        if (!check(size <= m_data.size() - m_pos)) return;
+        v.clear();
+        v.resize(size);
+        for (T& element : v) {
+            io(element);
+            if (!m_ok) return;
+        }
+    }
+
+    void io(Type*& v) { v = pointer_at(m_types, get(4)); }
+    void io(ArrayType*& v) { v = pointer_at(m_array_types, get(4)); }
+
+    template <class... Ts>
+    void io(std::variant<Ts...>& v)
+    {
+        emplace_alternative<0>(v, get(1));
+    }
+
+    void io(VarArgs&) {}
+
+    template <class T, std::enable_if_t<is_schema_struct_v<T>, int> = 0>
+    void io(T& v) { fields(*this, v); }
+
+    void type_pools(std::vector<std::unique_ptr<Type>>& types,
+                    std::vector<std::unique_ptr<ArrayType>>& array_types)
+    {
+        const std::size_t n_types = get(4);
+        const std::size_t n_array_types = get(4);
+        if (!check(n_types + n_array_types <= m_data.size() - m_pos)) return;
+
+        types.clear();
+        array_types.clear();
+        m_types.clear();
+        m_array_types.clear();
+        for (std::size_t i = 0; i < n_types; ++i) {
+            types.push_back(std::make_unique<Type>());
+            m_types.push_back(types.back().get());
+        }
+        for (std::size_t i = 0; i < n_array_types; ++i) {
+            array_types.push_back(std::make_unique<ArrayType>());
+            m_array_types.push_back(array_types.back().get());
+        }
+        for (auto& type : types) io(*type);
+        for (auto& type : array_types) io(*type);
+    }
+
+    bool ok() const { return m_ok && m_pos == m_data.size(); }
+
+private:
+    std::uint64_t get(int n_bytes)
+    {
+        if (!check(static_cast<std::size_t>(n_bytes) <= m_data.size() - m_pos)) return 0;
+        std::uint64_t value = 0;
+        for (int i = 0; i < n_bytes; ++i)
+            value |= std::uint64_t(static_cast<unsigned char>(m_data[m_pos++])) << (8 * i);
+        return value;
+    }
+
+    bool check(bool condition)
+    {
+        if (!condition) {
+            m_ok = false;
+            // Stop reading.
+            m_pos = m_data.size();
+        }
+        return m_ok;
+    }
+
+    template <class T>
+    T* pointer_at(const std::vector<T*>& pointers, std::uint64_t index)
+    {
+        if (index == NULL_INDEX) return nullptr;
+        if (!check(index < pointers.size())) return nullptr;
+        return pointers[index];
+    }
+
+    template <std::size_t I, class... Ts>
+    void emplace_alternative(std::variant<Ts...>& v, std::uint64_t index)
+    {
+        if constexpr (I < sizeof...(Ts)) {
+            if (index == I) {
+                io(v.template emplace<I>());
+            } else {
+                emplace_alternative<I + 1>(v, index);
+            }
+        } else {
+            check(false);
+        }
+    }
+
+    std::string_view m_data;
+    std::size_t m_pos = 0;
+    bool m_ok = true;
+    std::vector<Type*> m_types;
+    std::vector<ArrayType*> m_array_types;
+};
+
+std::string read_entire_file(const fs::path& path)
+{
+    std::ifstream file(path, std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+}  // namespace
+
+std::uint64_t hash_gir_contents(std::string_view contents)
+{
+    std::uint64_t hash = 0xcbf29ce484222325;
+    for (char c : contents) {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 0x100000001b3;
+    }
+    return hash;
+}
+
+std::string serialize_repository(const Repository& repo)
+{
+    Writer writer;
+    std::uint32_t version = IR_FORMAT_VERSION;
+    writer(version);
+    // The writer does not modify the repository.
+    writer.io(const_cast<Repository&>(repo));
+    return std::string(IR_MAGIC) + writer.take_data();
+}
+
+std::optional<Repository> deserialize_repository(std::string_view data)
+{
+    if (data.substr(0, IR_MAGIC.size()) != IR_MAGIC) return std::nullopt;
+    data.remove_prefix(IR_MAGIC.size());
+
+    Reader reader(data);
+    std::uint32_t version = 0;
+    reader(version);
+    if (version != IR_FORMAT_VERSION) return std::nullopt;
+
+    Repository repo;
+    reader.io(repo);
+    if (!reader.ok()) return std::nullopt;
+    return repo;
+}
+
+IrCache::IrCache(std::string dir) : m_dir(std::move(dir))
+{
+}
+
+std::string IrCache::entry_filepath(std::string_view gir_filepath, std::uint64_t hash) const
+{
+    const std::string stem = fs::path(gir_filepath).stem().string();
+    return (fs::path(m_dir) / fmt::format("{}-{:016x}.ir", stem, hash)).string();
+}
+
+std::optional<Repository> IrCache::load(std::string_view gir_filepath,
+                                        std::uint64_t hash) const
+{
+    const std::string path = entry_filepath(gir_filepath, hash);
+    std::error_code ec;
+    if (!fs::is_regular_file(path, ec)) return std::nullopt;
+
+    std::optional<Repository> repo = deserialize_repository(read_entire_file(path));
+    if (!repo) {
+        LOG_WARNV("Ignoring invalid IR cache entry {}", path);
+    }
+    return repo;
+}
+
+void IrCache::store(std::string_view gir_filepath, std::uint64_t hash,
+                    const Repository& repo) const
+{
+    const std::string path = entry_filepath(gir_filepath, hash);
+    // Write to a temporary file and rename it, so that a concurrent mmgir
+    // process never reads a partly written entry.
+    const std::string tmp_path = fmt::format("{}.{:08x}.tmp", path, std::random_device{}());
+
+    std::error_code ec;
+    fs::create_directories(m_dir, ec);
+    {
+        std::ofstream file(tmp_path, std::ios::binary | std::ios::trunc);
+        const std::string data = serialize_repository(repo);
+        file.write(data.data(), data.size());
+        if (!file) {
+            LOG_WARNV("Can't write IR cache entry {}", tmp_path);
+            file.close();
+            fs::remove(tmp_path, ec);
+            return;
+        }
+    }
+    fs::rename(tmp_path, path, ec);
+    if (ec) {
+        LOG_WARNV("Can't write IR cache entry {}: {}", path, ec.message());
+        fs::remove(tmp_path, ec);
+    }
+}
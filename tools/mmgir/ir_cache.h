@@ -0,0 +1,63 @@
+/* Copyright (C) 2026 The glibmm Development Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "schema.h"
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+
+// Serialized intermediate representation (IR) of parsed GIR files.
+//
+// Parsing takes most of mmgir's run time for large GIR files such as
+// Gtk-4.0.gir and its includes. IrCache stores each parsed gir::Repository in
+// a binary file whose name contains a hash of the GIR file's contents. A GIR
+// file that has not changed since an earlier run is read from the cache
+// instead of being parsed.
+//
+// Warnings that the parser prints are not stored. They are printed only when
+// a GIR file is parsed.
+
+// 64-bit FNV-1a hash of a GIR file's contents.
+std::uint64_t hash_gir_contents(std::string_view contents);
+
+std::string serialize_repository(const gir::Repository& repo);
+
+// Returns std::nullopt if data is not a repository serialized by the same
+// version of mmgir.
+std::optional<gir::Repository> deserialize_repository(std::string_view data);
+
+class IrCache
+{
+public:
+    explicit IrCache(std::string dir);
+
+    // Returns std::nullopt if there is no entry for the GIR file's contents.
+    std::optional<gir::Repository> load(std::string_view gir_filepath,
+                                        std::uint64_t hash) const;
+
+    // Errors are reported as warnings. The cache is only an optimization.
+    void store(std::string_view gir_filepath, std::uint64_t hash,
+               const gir::Repository& repo) const;
+
+private:
+    std::string entry_filepath(std::string_view gir_filepath, std::uint64_t hash) const;
+
+    std::string m_dir;
+};
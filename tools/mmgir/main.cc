@@ -15,6 +15,7 @@
  */
 
 #include "gen_defs.h"
+#include "ir_cache.h"
 #include "mmgir.h"
 #include "parse_gir.h"
 #include "type_resolver.h"
@@ -23,14 +24,76 @@
 #include <fmt/format.h>
 #include <fmt/ranges.h>
 
+#include <algorithm>
+#include <chrono>
 #include <filesystem>
 #include <fstream>
+#include <iterator>
 #include <optional>
+#include <sstream>
 #include <string>
+#include <thread>
 #include <vector>
 
 namespace fs = std::filesystem;
 
+namespace {
+
+// Prints the time spent in each phase if enabled
+class PhaseTimer
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    explicit PhaseTimer(bool enabled)
+        : m_enabled(enabled), m_start(Clock::now()), m_phase_start(m_start) {}
+
+    void end_phase(std::string_view phase)
+    {
+        const Clock::time_point now = Clock::now();
+        print(phase, now - m_phase_start);
+        m_phase_start = now;
+    }
+
+    void end() { print("total", Clock::now() - m_start); }
+
+private:
+    void print(std::string_view phase, Clock::duration duration) const
+    {
+        if (!m_enabled) return;
+        fmt::println("[TIME] {:<8} {:8.3f} s", phase,
+                     std::chrono::duration<double>(duration).count());
+    }
+
+    bool m_enabled;
+    Clock::time_point m_start;
+    Clock::time_point m_phase_start;
+};
+
+// Writes the defs unless the file already contains them. Unchanged files keep
+// their modification time, so build systems don't rebuild what depends on them.
+void write_defs_if_changed(std::string_view what, const std::string& filepath,
+                           const std::string& contents)
+{
+    {
+        std::ifstream old_file(filepath, std::ios::binary);
+        if (old_file) {
+            const std::string old_contents{std::istreambuf_iterator<char>(old_file),
+                                           std::istreambuf_iterator<char>()};
+            if (old_contents == contents) {
+                fmt::println("Unchanged {} defs in {}", what, filepath);
+                return;
+            }
+        }
+    }
+
+    fmt::println("Dumping {} defs to {}", what, filepath);
+    std::ofstream out(filepath, std::ios::binary | std::ios::trunc);
+    out << contents;
+}
+
+}  // namespace
+
 int main(int argc, char** argv)
 {
     CLI::App app{"Generates C++ wrappers based on GObject introspection"};
@@ -48,6 +111,10 @@ int main(int argc, char** argv)
     bool warn_ignored = false;
     bool warn_deprecated = false;
 
+    std::optional<std::string> ir_cache_dir;
+    unsigned jobs = std::max(1u, std::thread::hardware_concurrency());
+    bool print_timings = false;
+
     auto is_gir_file = [](const std::string& arg) {
         if (fs::path(arg).extension() == GIR_EXT) {
             return "";
@@ -82,32 +149,53 @@ int main(int argc, char** argv)
     app.add_flag("--warn-deprecated", warn_deprecated,
                  "Warn on deprecated elements/attributes");
 
+    app.add_option("--ir-cache-dir", ir_cache_dir,
+                   "Directory for parsed GIR files, reused while the GIR files are unchanged");
+    app.add_option("-j,--jobs", jobs, "Number of GIR files to parse concurrently")
+        ->check(CLI::PositiveNumber);
+    app.add_flag("--timings", print_timings, "Print the time spent in each phase");
+
     CLI11_PARSE(app, argc, argv);
 
-    const ParseArgs args{warn_unknown, warn_ignored, warn_deprecated};
+    std::optional<IrCache> ir_cache;
+    if (ir_cache_dir) {
+        ir_cache.emplace(*ir_cache_dir);
+    }
+
+    ParseArgs args{warn_unknown, warn_ignored, warn_deprecated};
+    args.ir_cache = ir_cache ? &*ir_cache : nullptr;
+    args.jobs = jobs;
+
+    PhaseTimer timer(print_timings);
+
+    // The input and supporting GIR files are independent of each other, so
+    // they are all parsed concurrently.
+    std::vector<std::string> all_gir_filepaths = gir_filepaths;
+    all_gir_filepaths.insert(all_gir_filepaths.end(), supporting_girs.begin(),
+                             supporting_girs.end());
 
     std::vector<gir::Repository> input_repos;
+    std::vector<gir::Repository> supporting_repos;
     try {
-        for (const std::string& filepath : gir_filepaths) {
-            input_repos.push_back(load_repository_from_file(filepath, args));
-        }
+        std::vector<gir::Repository> repos =
+            load_repositories_from_files(all_gir_filepaths, args);
+        const auto first_supporting = repos.begin() + gir_filepaths.size();
+        input_repos.assign(std::make_move_iterator(repos.begin()),
+                           std::make_move_iterator(first_supporting));
+        supporting_repos.assign(std::make_move_iterator(first_supporting),
+                                std::make_move_iterator(repos.end()));
     } catch (const GirParseError& e) {
         LOG_ERRORV("{}", e.what());
         return 1;
     }
+    timer.end_phase("parse");
 
     TypeResolver type_resolver;
     for (const gir::Repository& repo : input_repos) {
         type_resolver.register_repo_types(repo);
     }
-
-    std::vector<gir::Repository> supporting_repos;
-    try {
-        load_supporting_repositories(supporting_girs, args, supporting_repos,
-                                     type_resolver);
-    } catch (const GirParseError& e) {
-        LOG_ERRORV("{}", e.what());
-        return 1;
+    for (const gir::Repository& repo : supporting_repos) {
+        type_resolver.register_repo_types(repo);
     }
 
     try {
@@ -122,35 +210,38 @@ int main(int argc, char** argv)
         type_resolver.dump_unknown_types();
         return 1;
     }
+    timer.end_phase("resolve");
 
     {
-        fmt::println("Dumping enum defs to {}", enum_defs_filepath);
-        std::ofstream enum_defs_out(enum_defs_filepath);
+        std::ostringstream enum_defs_out;
         for (const gir::Repository& repo : input_repos) {
             generate_extended_enum_defs(enum_defs_out, repo);
         }
+        write_defs_if_changed("enum", enum_defs_filepath, enum_defs_out.str());
     }
     {
-        fmt::println("Dumping function defs to {}", function_defs_filepath);
-        std::ofstream function_defs_out(function_defs_filepath);
+        std::ostringstream function_defs_out;
         for (const gir::Repository& repo : input_repos) {
             generate_function_defs(function_defs_out, repo);
         }
+        write_defs_if_changed("function", function_defs_filepath, function_defs_out.str());
     }
     if (signal_defs_filepath) {
-        fmt::println("Dumping signal defs to {}", *signal_defs_filepath);
-        std::ofstream signal_defs_out(*signal_defs_filepath);
+        std::ostringstream signal_defs_out;
         for (const gir::Repository& repo : input_repos) {
             generate_signal_defs(signal_defs_out, repo, type_resolver);
         }
+        write_defs_if_changed("signal", *signal_defs_filepath, signal_defs_out.str());
     }
     if (vfunc_defs_filepath) {
-        fmt::println("Dumping vfunc defs to {}", *vfunc_defs_filepath);
-        std::ofstream vfunc_defs_out(*vfunc_defs_filepath);
+        std::ostringstream vfunc_defs_out;
         for (const gir::Repository& repo : input_repos) {
             generate_vfunc_defs(vfunc_defs_out, repo);
         }
+        write_defs_if_changed("vfunc", *vfunc_defs_filepath, vfunc_defs_out.str());
     }
+    timer.end_phase("generate");
+    timer.end();
 
     return 0;
 }
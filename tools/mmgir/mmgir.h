@@ -19,6 +19,8 @@
 #include <fmt/color.h>
 #include <fmt/format.h>
 
+#include <mutex>
+
 enum class LogLevel { INFO, WARN, ERROR };
 
 // Compile-time checked format strings in C++17
@@ -27,9 +29,16 @@ std::string format(fmt::format_string<Args...> fmt, Args&&... args) {
     return fmt::format(fmt, std::forward<Args>(args)...);
 }
 
+// GIR files are parsed in several threads. Messages must not be interleaved.
+inline std::mutex& log_mutex() {
+    static std::mutex mutex;
+    return mutex;
+}
+
 template <class... Args>
 void log(LogLevel level, fmt::format_string<Args...> fmt_str, Args&&... args) {
     auto message = fmt::format(fmt_str, std::forward<Args>(args)...);
+    std::lock_guard<std::mutex> lock(log_mutex());
 
     switch (level) {
         case LogLevel::ERROR:
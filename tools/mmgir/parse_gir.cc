@@ -18,6 +18,7 @@
 
 #include "parse_gir.h"
 
+#include "ir_cache.h"
 #include "type_resolver.h"
 
 #include <fmt/format.h>
@@ -25,9 +26,14 @@
 #include <tinyxml2.h>
 
 #include <algorithm>
+#include <atomic>
+#include <exception>
 #include <filesystem>
+#include <fstream>
 #include <functional>
+#include <iterator>
 #include <queue>
+#include <thread>
 
 #define PARSE_ERROR(lineno, msg) \
     m_has_errors = true; \
@@ -243,17 +249,30 @@ public:
     GirSearch(TypeResolver& resolver, std::vector<Repository>& supporting_repos);
 
     void add_includes(const Repository& repo);
-    void load_gir_xml_files(const std::vector<std::string>& search_dirs);
+    void load_gir_xml_files(const std::vector<std::string>& search_dirs,
+                            const ParseArgs& args);
     void run(const ParseArgs& args);
 
 private:
+    struct GirFile {
+        std::string filepath;
+        std::uint64_t hash = 0;
+        // Either the XML document or the repository from the IR cache is set
+        std::unique_ptr<XMLDocument> doc;
+        std::optional<Repository> cached_repo;
+        // Set when the repository has been added to the supporting repos.
+        // Then doc and cached_repo are no longer needed.
+        bool loaded = false;
+    };
+
     std::string combined_name(std::string_view name, std::string_view version);
     bool mark_visited_namespace(std::string_view name, std::string_view version);
+    void map_namespace(const char* name, const char* version, size_t doc_index);
 
     TypeResolver& m_type_resolver;
     std::vector<Repository>& m_supporting_repos;
 
-    std::vector<std::pair<std::unique_ptr<XMLDocument>, std::string>> m_docs;
+    std::vector<GirFile> m_docs;
     std::map<std::string, size_t> m_namespace_to_doc;
 
     std::queue<Include> m_queue;
@@ -265,6 +284,50 @@ bool is_legal_prefix_char(unsigned char c) {
     return std::isalnum(c) || c == '_';
 }
 
+// Calls func(i) for each i in [0, count), in up to `jobs` threads.
+// Exceptions are rethrown after all calls have finished. If several calls
+// throw, the exception with the lowest i is rethrown.
+template <class Func>
+void parallel_for(size_t count, unsigned jobs, Func func)
+{
+    std::vector<std::exception_ptr> errors(count);
+    std::atomic<size_t> next_index{0};
+
+    auto worker = [&]() {
+        for (size_t i = next_index++; i < count; i = next_index++) {
+            try {
+                func(i);
+            } catch (...) {
+                errors[i] = std::current_exception();
+            }
+        }
+    };
+
+    const size_t n_threads = std::min<size_t>(std::max(jobs, 1u), count);
+    std::vector<std::thread> threads;
+    for (size_t i = 1; i < n_threads; ++i) {
+        threads.emplace_back(worker);
+    }
+    worker();
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    for (const std::exception_ptr& error : errors) {
+        if (error) std::rethrow_exception(error);
+    }
+}
+
+std::optional<std::string> read_file(std::string_view filepath)
+{
+    std::ifstream file(fs::u8path(filepath), std::ios::binary);
+    if (!file) return std::nullopt;
+    std::string contents{std::istreambuf_iterator<char>(file),
+                         std::istreambuf_iterator<char>()};
+    if (file.bad()) return std::nullopt;
+    return contents;
+}
+
 }  // namespace
 
 std::optional<bool> Parser::parse_opt_bool(const XMLAttribute* attr)
@@ -1826,8 +1889,13 @@ bool GirSearch::mark_visited_namespace(std::string_view name, std::string_view v
 // Each namespace found in the document is mapped to the corresponding document
 // using <NAME>-<VERSION> as the key if a version exists. If not, it is mapped
 // using just the name as the key.
-void GirSearch::load_gir_xml_files(const std::vector<std::string>& search_dirs)
+//
+// Files that are in the IR cache are not parsed as XML. The namespaces are
+// taken from the cached repository instead.
+void GirSearch::load_gir_xml_files(const std::vector<std::string>& search_dirs,
+                                   const ParseArgs& args)
 {
+    std::vector<GirFile> files;
     for (const std::string& search_dir : search_dirs) {
         fs::path dir_path(search_dir);
         if (!fs::is_directory(dir_path)) continue;
@@ -1835,40 +1903,70 @@ void GirSearch::load_gir_xml_files(const std::vector<std::string>& search_dirs)
         for (const auto& dir_entry : fs::directory_iterator{dir_path}) {
             if (dir_entry.path().extension().string() != GIR_EXT) continue;
 
-            auto doc = std::make_unique<XMLDocument>();
-            if (doc->LoadFile(dir_entry.path().u8string().c_str()) != XML_SUCCESS) continue;
+            GirFile& file = files.emplace_back();
+            file.filepath = dir_entry.path().string();
+        }
+    }
 
-            const XMLElement* root = doc->FirstChildElement(REPOSITORY_ELEMENT);
-            if (!root) continue;
+    parallel_for(files.size(), args.jobs, [&](size_t i) {
+        GirFile& file = files[i];
+        std::optional<std::string> contents = read_file(file.filepath);
+        if (!contents) return;
+
+        if (args.ir_cache) {
+            file.hash = hash_gir_contents(*contents);
+            file.cached_repo = args.ir_cache->load(file.filepath, file.hash);
+            if (file.cached_repo) return;
+        }
 
-            const size_t doc_index = m_docs.size();
-            bool found_namespace = false;
+        auto doc = std::make_unique<XMLDocument>();
+        if (doc->Parse(contents->data(), contents->size()) != XML_SUCCESS) return;
+        file.doc = std::move(doc);
+    });
+
+    for (GirFile& file : files) {
+        const size_t doc_index = m_docs.size();
+        bool found_namespace = false;
+
+        if (file.cached_repo) {
+            for (const Namespace& ns : file.cached_repo->namespaces) {
+                if (!ns.name) continue;
+                map_namespace(ns.name->c_str(),
+                              ns.version ? ns.version->c_str() : nullptr, doc_index);
+                found_namespace = true;
+            }
+        } else if (file.doc) {
+            const XMLElement* root = file.doc->FirstChildElement(REPOSITORY_ELEMENT);
+            if (!root) continue;
 
             const XMLElement* ns_element =
                 root->FirstChildElement(NAMESPACE_ELEMENT);
             while (ns_element) {
                 const char* name = ns_element->Attribute("name");
                 if (name) {
-                    const char* version = ns_element->Attribute("version");
-                    if (version) {
-                        std::string key = fmt::format("{}-{}", name, version);
-                        m_namespace_to_doc.emplace(key, doc_index);
-                    } else {
-                        m_namespace_to_doc.emplace(name, doc_index);
-                    }
-
+                    map_namespace(name, ns_element->Attribute("version"), doc_index);
                     found_namespace = true;
                 }
                 ns_element = ns_element->NextSiblingElement(NAMESPACE_ELEMENT);
             }
+        }
 
-            if (found_namespace) {
-                m_docs.emplace_back(std::move(doc), dir_entry.path().string());
-            }
+        if (found_namespace) {
+            m_docs.push_back(std::move(file));
         }
     }
 }
 
+void GirSearch::map_namespace(const char* name, const char* version, size_t doc_index)
+{
+    if (version) {
+        std::string key = fmt::format("{}-{}", name, version);
+        m_namespace_to_doc.emplace(key, doc_index);
+    } else {
+        m_namespace_to_doc.emplace(name, doc_index);
+    }
+}
+
 void GirSearch::run(const ParseArgs& args)
 {
     std::vector<std::string> missing_dependencies;
@@ -1895,14 +1993,26 @@ void GirSearch::run(const ParseArgs& args)
             continue;
         }
 
-        auto& [doc, filename] = m_docs.at(it->second);
-        fmt::println("Reading auto-discovered {}", filename);
+        GirFile& file = m_docs.at(it->second);
+        // Another namespace of the same file has already loaded all of them
+        if (file.loaded) continue;
+        file.loaded = true;
 
-        Parser parser(args);
-        m_supporting_repos.push_back(parser.parse_repo(*doc));
+        fmt::println("Reading auto-discovered {}", file.filepath);
 
-        if (parser.has_errors()) {
-            found_errors = true;
+        if (file.cached_repo) {
+            m_supporting_repos.push_back(std::move(*file.cached_repo));
+            file.cached_repo.reset();
+        } else {
+            Parser parser(args);
+            m_supporting_repos.push_back(parser.parse_repo(*file.doc));
+            file.doc.reset();
+
+            if (parser.has_errors()) {
+                found_errors = true;
+            } else if (args.ir_cache) {
+                args.ir_cache->store(file.filepath, file.hash, m_supporting_repos.back());
+            }
         }
 
         m_type_resolver.register_repo_types(m_supporting_repos.back());
@@ -1920,32 +2030,47 @@ void GirSearch::run(const ParseArgs& args)
 Repository load_repository_from_file(std::string_view filepath,
                                      const ParseArgs& args)
 {
-    fmt::println("Reading {}", filepath);
+    log(LogLevel::INFO, "Reading {}", filepath);
+
+    std::optional<std::string> contents = read_file(filepath);
+    if (!contents) {
+        throw GirParseError(fmt::format("Can't read {}", filepath));
+    }
+
+    std::uint64_t hash = 0;
+    if (args.ir_cache) {
+        hash = hash_gir_contents(*contents);
+        if (std::optional<Repository> repo = args.ir_cache->load(filepath, hash)) {
+            return std::move(*repo);
+        }
+    }
 
     XMLDocument doc;
-    if (doc.LoadFile(filepath.data()) != XML_SUCCESS) {
-        throw GirParseError(doc.ErrorStr());
+    if (doc.Parse(contents->data(), contents->size()) != XML_SUCCESS) {
+        throw GirParseError(fmt::format("{}: {}", filepath, doc.ErrorStr()));
     }
 
     Parser parser(args);
     Repository repo = parser.parse_repo(doc);
 
     if (parser.has_errors()) {
-        throw GirParseError("GIR has errors");
+        throw GirParseError(fmt::format("{} has errors", filepath));
     }
 
+    if (args.ir_cache) {
+        args.ir_cache->store(filepath, hash, repo);
+    }
     return repo;
 }
 
-void load_supporting_repositories(const std::vector<std::string>& paths,
-                                  const ParseArgs& args,
-                                  std::vector<gir::Repository>& supporting_repos,
-                                  TypeResolver& type_resolver)
+std::vector<Repository> load_repositories_from_files(
+    const std::vector<std::string>& filepaths, const ParseArgs& args)
 {
-    for (const std::string& supporting_file : paths) {
-        supporting_repos.emplace_back(load_repository_from_file(supporting_file, args));
-        type_resolver.register_repo_types(supporting_repos.back());
-    }
+    std::vector<Repository> repos(filepaths.size());
+    parallel_for(filepaths.size(), args.jobs, [&](size_t i) {
+        repos[i] = load_repository_from_file(filepaths[i], args);
+    });
+    return repos;
 }
 
 void search_for_included_namespaces(const std::vector<std::string>& paths,
@@ -1964,6 +2089,6 @@ void search_for_included_namespaces(const std::vector<std::string>& paths,
         search.add_includes(repo);
     }
 
-    search.load_gir_xml_files(paths);
+    search.load_gir_xml_files(paths, args);
     search.run(args);
 }
@@ -21,7 +21,9 @@
 #include <stdexcept>
 #include <string>
 #include <string_view>
+#include <vector>
 
+class IrCache;
 class TypeResolver;
 
 struct GirParseError : std::runtime_error {
@@ -32,6 +34,10 @@ struct ParseArgs {
     bool warn_unknown = false;
     bool warn_ignored = false;
     bool warn_deprecated = false;
+    // If set, parsed GIR files are stored in and loaded from the cache
+    const IrCache* ir_cache = nullptr;
+    // Maximum number of GIR files to parse concurrently
+    unsigned jobs = 1;
 };
 
 constexpr const char* const GIR_EXT = ".gir";
@@ -39,10 +45,11 @@ constexpr const char* const GIR_EXT = ".gir";
 gir::Repository load_repository_from_file(std::string_view filepath,
                                           const ParseArgs& args);
 
-void load_supporting_repositories(const std::vector<std::string>& paths,
-                                  const ParseArgs& args,
-                                  std::vector<gir::Repository>& supporting_repos,
-                                  TypeResolver& type_resolver);
+// Parses the GIR files concurrently. The repositories are returned in the
+// order of the filepaths. If any file has errors, the error of the first such
+// file is thrown after all files have been parsed.
+std::vector<gir::Repository> load_repositories_from_files(
+    const std::vector<std::string>& filepaths, const ParseArgs& args);
 
 void search_for_included_namespaces(const std::vector<std::string>& paths,
                                     const ParseArgs& args,
@@ -31,6 +31,9 @@ overloads(Ts...) -> overloads<Ts...>;
 
 // Schema based on gir-1.2.rnc
 // https://gitlab.gnome.org/GNOME/gobject-introspection/-/blob/main/docs/gir-1.2.rnc
+//
+// When changing these structs, update the serialization in ir_cache.cc and
+// increment IR_FORMAT_VERSION.
 namespace gir {
 
 struct ArrayType;
@@ -252,7 +255,7 @@ struct InstanceParam
     std::optional<TransferOwnership> ownership;
 
     DocElements doc_elements;
-    Type* type;
+    Type* type = nullptr;
 };
 
 struct CallableParams
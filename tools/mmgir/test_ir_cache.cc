@@ -0,0 +1,168 @@
+/* Copyright (C) 2026 The glibmm Development Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "ir_cache.h"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <filesystem>
+#include <random>
+
+using namespace gir;
+
+namespace fs = std::filesystem;
+
+namespace {
+
+Repository make_repository()
+{
+    Repository repo;
+    repo.version = "1.2";
+    repo.includes.push_back(Include{"GObject", "2.0"});
+
+    Namespace& ns = repo.namespaces.emplace_back();
+    ns.name = "Gio";
+    ns.version = "2.0";
+    ns.identifier_prefixes = {"G"};
+    ns.symbol_prefixes = {"g"};
+
+    ns.types.push_back(std::make_unique<Type>());
+    Type* utf8_type = ns.types.back().get();
+    utf8_type->name = "utf8";
+    utf8_type->c_type = "const char*";
+
+    ns.types.push_back(std::make_unique<Type>());
+    Type* instance_type = ns.types.back().get();
+    instance_type->name = "Application";
+    instance_type->c_type = "GApplication*";
+
+    ns.array_types.push_back(std::make_unique<ArrayType>());
+    ArrayType* array_type = ns.array_types.back().get();
+    array_type->c_type = "gchar**";
+    array_type->is_zero_terminated = true;
+    array_type->element_type = utf8_type;
+
+    Class& cls = ns.classes.emplace_back();
+    cls.name = "Application";
+    cls.glib_type_name = "GApplication";
+    cls.glib_type_func = "g_application_get_type";
+    cls.parent = "GObject.Object";
+    cls.info_attributes.stability = Stability::STABLE;
+    cls.info_elements.doc_elements.doc = Documentation{{"gapplication.c", 42, 3}, "Doc"};
+
+    Method& method = cls.methods.emplace_back();
+    method.func.detail.attributes.name = "set_application_id";
+    method.func.detail.attributes.c_identifier = "g_application_set_application_id";
+    CallableParams& params = method.func.detail.params.emplace();
+    params.instance_param.emplace().type = instance_type;
+    params.instance_param->name = "application";
+    Param& param = params.params.emplace_back();
+    param.name = "application_id";
+    param.is_nullable = true;
+    param.direction = Dir::IN;
+    param.ownership = TransferOwnership::NONE;
+    param.type = AnyType{utf8_type};
+    Param& varargs = params.params.emplace_back();
+    varargs.type = VarArgs{};
+    method.func.detail.return_type.emplace().type = static_cast<Type*>(nullptr);
+
+    Property& property = cls.properties.emplace_back();
+    property.name = "flags";
+    property.is_writable = true;
+    property.type = array_type;
+
+    Enum& enumeration = ns.enums.emplace_back();
+    enumeration.name = "ApplicationFlags";
+    enumeration.members.push_back(Member{{}, "none", "-1", "G_APPLICATION_FLAGS_NONE", {}, {}});
+
+    return repo;
+}
+
+}  // namespace
+
+TEST_CASE("serialized repository round trip", "[ir_cache]")
+{
+    const Repository repo = make_repository();
+    const std::string data = serialize_repository(repo);
+
+    std::optional<Repository> result = deserialize_repository(data);
+    REQUIRE(result);
+    REQUIRE(result->version == repo.version);
+    REQUIRE(result->includes.size() == 1);
+    REQUIRE(result->includes[0].version == "2.0");
+    REQUIRE(result->namespaces.size() == 1);
+
+    const Namespace& ns = result->namespaces[0];
+    REQUIRE(ns.name == "Gio");
+    REQUIRE(ns.types.size() == 2);
+    REQUIRE(ns.array_types.size() == 1);
+    REQUIRE(ns.classes.size() == 1);
+    REQUIRE(ns.enums.size() == 1);
+    REQUIRE(ns.enums[0].members[0].value == "-1");
+
+    const Class& cls = ns.classes[0];
+    REQUIRE(cls.parent == "GObject.Object");
+    REQUIRE(cls.info_attributes.stability == Stability::STABLE);
+    REQUIRE(cls.info_elements.doc_elements.doc);
+    REQUIRE(cls.info_elements.doc_elements.doc->src_pos.line == 42);
+    REQUIRE(cls.info_elements.doc_elements.doc->src_pos.column == 3);
+
+    // Type pointers refer to the types of the deserialized namespace
+    const CallableParams& params = *cls.methods[0].func.detail.params;
+    REQUIRE(params.instance_param->type == ns.types[1].get());
+    REQUIRE(params.params.size() == 2);
+    REQUIRE(params.params[0].is_nullable == true);
+    REQUIRE(params.params[0].direction == Dir::IN);
+    REQUIRE(std::get<AnyType>(*params.params[0].type) == AnyType{ns.types[0].get()});
+    REQUIRE(std::holds_alternative<VarArgs>(*params.params[1].type));
+    REQUIRE(std::get<Type*>(cls.methods[0].func.detail.return_type->type) == nullptr);
+
+    const ArrayType* array_type = std::get<ArrayType*>(cls.properties[0].type);
+    REQUIRE(array_type == ns.array_types[0].get());
+    REQUIRE(array_type->is_zero_terminated == true);
+    REQUIRE(std::get<Type*>(array_type->element_type) == ns.types[0].get());
+
+    // Serialization is deterministic
+    REQUIRE(serialize_repository(*result) == data);
+}
+
+TEST_CASE("truncated serialized repository", "[ir_cache]")
+{
+    const std::string data = serialize_repository(make_repository());
+    for (std::size_t size = 0; size < data.size(); ++size) {
+        REQUIRE(!deserialize_repository(std::string_view(data).substr(0, size)));
+    }
+    REQUIRE(!deserialize_repository(data + '\0'));
+}
+
+TEST_CASE("IR cache entries are keyed by contents hash", "[ir_cache]")
+{
+    const fs::path dir = fs::temp_directory_path() /
+        ("mmgir-test-ir-cache-" + std::to_string(std::random_device{}()));
+    const IrCache cache(dir.string());
+
+    const std::uint64_t hash = hash_gir_contents("<repository/>");
+    REQUIRE(hash != hash_gir_contents("<repository />"));
+    REQUIRE(!cache.load("/usr/share/gir-1.0/Gio-2.0.gir", hash));
+
+    cache.store("/usr/share/gir-1.0/Gio-2.0.gir", hash, make_repository());
+    std::optional<Repository> result = cache.load("/usr/share/gir-1.0/Gio-2.0.gir", hash);
+    REQUIRE(result);
+    REQUIRE(result->namespaces.at(0).name == "Gio");
+    REQUIRE(!cache.load("/usr/share/gir-1.0/Gio-2.0.gir", hash + 1));
+
+    fs::remove_all(dir);
+}
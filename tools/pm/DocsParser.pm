@@ -23,7 +23,6 @@ package DocsParser;
 use XML::Parser;
 use strict;
 use warnings;
-use feature 'state';
 
 use Util;
 use Function;
@@ -69,7 +68,81 @@ $DocsParser::commentStart = "  /** ";
 $DocsParser::commentMiddleStart = "   * ";
 $DocsParser::commentEnd = "   */";
 
+# The keys of %DocsParser::enumerator_name_prefixes in reverse sort order,
+# or undef if not yet sorted.
+$DocsParser::sorted_enumerator_name_prefixes = undef;
+
+# The documentation files that have been parsed. When gmmproc processes several
+# .hg files in one run (--batch), each file is parsed only once.
+%DocsParser::parsed = (); # "path/file path/override" => { functions => {...}, ... }
+
+# The directory of the persistent cache of parsed documentation files, or "".
+$DocsParser::cache_dir = "";
+
+my @parsed_hashes = qw(functions type_names enumerator_name_prefixes enumerator_names);
+
+sub parsed_hashes()
+{
+  return (functions => \%DocsParser::hasharrayFunctions,
+          type_names => \%DocsParser::type_names,
+          enumerator_name_prefixes => \%DocsParser::enumerator_name_prefixes,
+          enumerator_names => \%DocsParser::enumerator_names);
+}
+
+# void read_defs($path, $filename, $filename_override)
+# Adds the documentation in a C documentation file and its override file.
+# Files that have been parsed before, in this run or (with a cache directory)
+# in an earlier run, are not parsed again.
 sub read_defs($$$)
+{
+  my ($path, $filename, $filename_override) = @_;
+  my $key = "$path/$filename $path/$filename_override";
+
+  my $parsed = $DocsParser::parsed{$key};
+  if (!$parsed && $DocsParser::cache_dir)
+  {
+    $parsed = Util::cache_load($DocsParser::cache_dir, "docs $key");
+  }
+  if (!$parsed)
+  {
+    # Parse into empty hashes, and keep the result separately.
+    my %hashes = parsed_hashes();
+    my %saved = map { $_ => { %{$hashes{$_}} } } @parsed_hashes;
+    %{$hashes{$_}} = () foreach (@parsed_hashes);
+
+    parse_files($path, $filename, $filename_override);
+
+    $parsed = {};
+    foreach my $name (@parsed_hashes)
+    {
+      $$parsed{$name} = { %{$hashes{$name}} };
+      %{$hashes{$name}} = %{$saved{$name}};
+    }
+    Util::cache_store($DocsParser::cache_dir, "docs $key", $parsed,
+      "$path/$filename", "$path/$filename_override") if ($DocsParser::cache_dir);
+  }
+  $DocsParser::parsed{$key} = $parsed;
+
+  my %hashes = parsed_hashes();
+  foreach my $name (@parsed_hashes)
+  {
+    my $from = $$parsed{$name};
+    @{$hashes{$name}}{keys %$from} = values %$from;
+  }
+  $DocsParser::sorted_enumerator_name_prefixes = undef;
+}
+
+# void clear()
+# Forgets all documentation, before the next .hg file is processed in batch mode.
+# The parsed files are kept, so read_defs() does not parse them again.
+sub clear()
+{
+  my %hashes = parsed_hashes();
+  %{$hashes{$_}} = () foreach (@parsed_hashes);
+  $DocsParser::sorted_enumerator_name_prefixes = undef;
+}
+
+sub parse_files($$$)
 {
   my ($path, $filename, $filename_override) = @_;
 
@@ -927,9 +1000,6 @@ sub substitute_enumerator_name3($$$)
 
 sub substitute_enumerator_name($$)
 {
-  state $first_call = 1;
-  state @sorted_keys;
-
   my ($module, $name) = @_;
   my $c_name = $module . "_" . $name;
 
@@ -938,21 +1008,16 @@ sub substitute_enumerator_name($$)
     return $DocsParser::enumerator_names{$c_name};
   }
 
-  if ($first_call)
-  {
-    # Sort only once, on the first call.
-    # "state @sorted_keys = ...;" is not possible. Only a scalar variable
-    # can have a one-time assignment in its defining "state" statement.
-    $first_call = 0;
-    @sorted_keys = reverse sort keys(%DocsParser::enumerator_name_prefixes);
-  }
+  # Sort only once, unless more documentation has been read.
+  $DocsParser::sorted_enumerator_name_prefixes //=
+    [ reverse sort keys(%DocsParser::enumerator_name_prefixes) ];
 
   # This is a linear search through the keys of %DocsParser::enumerator_name_prefixes.
   # It's inefficient if %DocsParser::enumerator_name_prefixes contains many values.
   #
   # If one key is part of another key (e.g. G_REGEX_MATCH_ and G_REGEX_),
   # search for a match against the longer key before the shorter key.
-  foreach my $key (@sorted_keys)
+  foreach my $key (@$DocsParser::sorted_enumerator_name_prefixes)
   {
     if ($c_name =~ m/^$key/)
     {
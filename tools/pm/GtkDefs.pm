@@ -29,6 +29,7 @@ use FunctionBase;
 #
 #  Public functions
 #    read_defs(path, file)
+#    clear()
 #
 #    @ get_methods()
 #    @ get_signals()
@@ -81,12 +82,109 @@ use warnings;
 @GtkDefs::read = ();
 @GtkDefs::file = ();
 
+# The defs files that have been parsed, and what each of them (including the
+# files that it includes) defines. When gmmproc processes several .hg files
+# in one run (--batch), each defs file is parsed only once.
+%GtkDefs::parsed = (); # "path/file" => { files => [...], enums => {...}, ... }
+
+# The directory of the persistent cache of parsed defs files, or "".
+$GtkDefs::cache_dir = "";
+
+my @entity_kinds = qw(enums objects methods signals properties child_properties);
+
+sub entity_hashes()
+{
+  return (enums => \%GtkDefs::enums, objects => \%GtkDefs::objects,
+          methods => \%GtkDefs::methods, signals => \%GtkDefs::signals,
+          properties => \%GtkDefs::properties,
+          child_properties => \%GtkDefs::child_properties);
+}
+
 
 #####################################
 #prototype to get rid of warning
-sub read_defs($$;$);
+sub parse_defs($$;$);
 
+# void read_defs($path, $filename, $restrict)
+# Adds the definitions in a defs file, and in the files it includes.
+# A file that has been parsed before, in this run or (with a cache directory)
+# in an earlier run, is not parsed again.
 sub read_defs($$;$)
+{
+  my ($path, $filename, $restrict) = @_;
+  $restrict = "" if ($#_ < 2);
+  my $key = "$path/$filename";
+
+  # don't read a file twice
+  return if (grep { $_ eq $key } @GtkDefs::read);
+
+  my $parsed = $GtkDefs::parsed{$key};
+  if (!$parsed && $GtkDefs::cache_dir)
+  {
+    $parsed = Util::cache_load($GtkDefs::cache_dir, "defs $key");
+  }
+  if (!$parsed)
+  {
+    $parsed = parse_defs_separately($path, $filename, $restrict);
+    Util::cache_store($GtkDefs::cache_dir, "defs $key", $parsed, @{$$parsed{files}})
+      if ($GtkDefs::cache_dir);
+  }
+  $GtkDefs::parsed{$key} = $parsed;
+
+  # Files parsed later override definitions in files parsed earlier.
+  my %hashes = entity_hashes();
+  foreach my $kind (@entity_kinds)
+  {
+    my $from = $$parsed{$kind};
+    @{$hashes{$kind}}{keys %$from} = values %$from;
+  }
+  push @GtkDefs::read, @{$$parsed{files}};
+}
+
+# $parsed parse_defs_separately($path, $filename, $restrict)
+# Parses a defs file without adding its definitions.
+sub parse_defs_separately($$$)
+{
+  my ($path, $filename, $restrict) = @_;
+
+  my %hashes = entity_hashes();
+  my %saved = map { $_ => { %{$hashes{$_}} } } @entity_kinds;
+  my @saved_read = @GtkDefs::read;
+  %{$hashes{$_}} = () foreach (@entity_kinds);
+  @GtkDefs::read = ();
+
+  parse_defs($path, $filename, $restrict);
+
+  my %parsed = (files => [ @GtkDefs::read ]);
+  foreach my $kind (@entity_kinds)
+  {
+    $parsed{$kind} = { %{$hashes{$kind}} };
+    %{$hashes{$kind}} = %{$saved{$kind}};
+  }
+  @GtkDefs::read = @saved_read;
+
+  return \%parsed;
+}
+
+# void clear()
+# Forgets all definitions, before the next .hg file is processed in batch mode.
+# The parsed defs files are kept, so read_defs() does not parse them again.
+sub clear()
+{
+  my %hashes = entity_hashes();
+  %{$hashes{$_}} = () foreach (@entity_kinds);
+  @GtkDefs::read = ();
+
+  foreach my $parsed (values %GtkDefs::parsed)
+  {
+    foreach my $kind (qw(enums methods signals properties child_properties))
+    {
+      $$_{mark} = 0 foreach (values %{$$parsed{$kind}});
+    }
+  }
+}
+
+sub parse_defs($$;$)
 {
   my ($path, $filename, $restrict) = @_;
   $restrict = "" if ($#_ < 2);
@@ -95,6 +193,9 @@ sub read_defs($$;$)
   if ( ! -r "$path/$filename")
   {
      print "Error: can't read defs file $filename\n";
+     # Remember it, so that a cached parse result is not used if the
+     # file is added.
+     push @GtkDefs::read, "$path/$filename";
      return;
   }
 
@@ -135,7 +236,7 @@ sub read_defs($$;$)
 
     if ($token =~ /\(include (\S+)\)/)
     {
-      read_defs($path,$1,$restrict);
+      parse_defs($path,$1,$restrict);
       next;
     }
     elsif ($token =~ /^\(define-flags-extended.*\)$/)
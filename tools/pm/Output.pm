@@ -36,6 +36,9 @@ sub new
 
   $$self{source} = "";
   $$self{tmpdir} = File::Spec->tmpdir();
+  # Base name of the *.g1 and *.g2 temporary files. gmmproc --batch makes it
+  # unique for each .hg file.
+  $$self{tmpname} = "gtkmmproc_$$"; # $$ is the Process ID
   $$self{destdir} = "";
   $$self{objDefsParser} = undef; # It will be set in set_defsparser()
 
@@ -1088,7 +1091,7 @@ sub output_temp_g1($$$)
   my ($self, $module, $glibmm_version) = @_;
 
   # Write out *.g1 temporary file
-  open(FILE, '>', "$$self{tmpdir}/gtkmmproc_$$.g1");  # $$ is the Process ID
+  open(FILE, '>', "$$self{tmpdir}/$$self{tmpname}.g1");
 
   print FILE "include(base.m4)dnl\n";
 
@@ -1104,7 +1107,7 @@ sub make_g2_from_g1($)
   my ($self) = @_;
 
   # Execute m4 to get *.g2 file:
-  system("$$self{m4path} $$self{m4args} \"$$self{tmpdir}/gtkmmproc_$$.g1\" > \"$$self{tmpdir}/gtkmmproc_$$.g2\"");
+  system("$$self{m4path} $$self{m4args} \"$$self{tmpdir}/$$self{tmpname}.g1\" > \"$$self{tmpdir}/$$self{tmpname}.g2\"");
   return ($? >> 8);
 }
 
@@ -1118,7 +1121,7 @@ sub write_sections_to_files()
   my $fname_ph = "$$self{destdir}/private/$$self{source}_p.h";
   my $fname_cc = "$$self{destdir}/$$self{source}.cc";
 
-  open(INPUT, '<', "$$self{tmpdir}/gtkmmproc_$$.g2"); # $$ is the process ID.
+  open(INPUT, '<', "$$self{tmpdir}/$$self{tmpname}.g2");
 
   # open temporary file for each section
   open(OUTPUT_H,  '>', "$fname_h.tmp");
@@ -1165,8 +1168,8 @@ sub remove_temp_files($)
 {
   my ($self) = @_;
 
-  system("rm -f \"$$self{tmpdir}/gtkmmproc_$$.g1\"");
-  system("rm -f \"$$self{tmpdir}/gtkmmproc_$$.g2\"");
+  system("rm -f \"$$self{tmpdir}/$$self{tmpname}.g1\"");
+  system("rm -f \"$$self{tmpdir}/$$self{tmpname}.g2\"");
 }
 
 
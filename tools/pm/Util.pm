@@ -108,5 +108,88 @@ sub unique(@)
   return keys %hash;
 }
 
+# Persistent cache of parsed input files, used by gmmproc's --cache option.
+# A cache entry is valid as long as the files it was made from are unchanged.
+# Unreadable or stale entries are ignored; then the input files are parsed.
+# The modules are loaded only when a cache is used.
+sub cache_require_modules()
+{
+  require Digest::SHA;
+  require File::Path;
+  require File::Spec;
+  require Storable;
+}
+
+# $ file_digest($filename)
+# Returns the SHA-1 of the contents of a file, or "" if it can't be read.
+sub file_digest($)
+{
+  my ($filename) = @_;
+
+  return "" unless (-r $filename);
+  my $sha = Digest::SHA->new(1);
+  eval { $sha->addfile($filename) };
+  return $@ ? "" : $sha->hexdigest();
+}
+
+sub cache_filename($$)
+{
+  my ($cache_dir, $key) = @_;
+
+  # $main::glibmm_version is part of the key, because the format of the
+  # cached objects may change with gmmproc.
+  my $version = defined($main::glibmm_version) ? $main::glibmm_version : "";
+  return File::Spec->catfile($cache_dir,
+    "gmmproc-" . Digest::SHA::sha1_hex("$version $key") . ".cache");
+}
+
+# $data cache_load($cache_dir, $key)
+# Returns the cached data, or undef if there's no valid cache entry.
+sub cache_load($$)
+{
+  my ($cache_dir, $key) = @_;
+
+  cache_require_modules();
+  my $filename = cache_filename($cache_dir, $key);
+  return undef unless (-r $filename);
+
+  my $entry = eval { Storable::retrieve($filename) };
+  return undef if ($@ || ref($entry) ne "HASH" || $$entry{key} ne $key);
+
+  foreach my $input (keys %{$$entry{digests}})
+  {
+    return undef if (file_digest($input) ne $$entry{digests}{$input});
+  }
+  return $$entry{data};
+}
+
+# void cache_store($cache_dir, $key, $data, @input_files)
+# Stores data that has been made from the contents of @input_files.
+sub cache_store($$$@)
+{
+  my ($cache_dir, $key, $data, @input_files) = @_;
+
+  cache_require_modules();
+  # The entry is also invalid if the modules that parse the input files change.
+  push(@input_files, grep { defined } @INC{qw(GtkDefs.pm DocsParser.pm Enum.pm Function.pm
+    FunctionBase.pm Object.pm Property.pm Util.pm)});
+  my %digests = map { $_ => file_digest($_) } @input_files;
+  my $filename = cache_filename($cache_dir, $key);
+
+  # Write to a temporary file and rename it, so that concurrent gmmproc
+  # processes never read a partly written entry.
+  eval
+  {
+    File::Path::make_path($cache_dir) unless (-d $cache_dir);
+    Storable::nstore({ key => $key, digests => \%digests, data => $data }, "$filename.$$");
+    rename("$filename.$$", $filename) or die;
+  };
+  if ($@)
+  {
+    unlink("$filename.$$");
+    print STDERR "gmmproc: Warning: Can't write cache file $filename.\n";
+  }
+}
+
 1; # indicate proper module load.
 